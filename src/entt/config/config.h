@@ -12,5 +12,20 @@
 #endif // ENTT_HS_SUFFIX
 
 
+#ifndef ENTT_PAGE_SIZE
+#define ENTT_PAGE_SIZE 32768
+#endif // ENTT_PAGE_SIZE
+
+
+#ifndef ENTT_CACHE_LINE_SIZE
+#define ENTT_CACHE_LINE_SIZE 64
+#endif // ENTT_CACHE_LINE_SIZE
+
+
+#ifndef ENTT_SIGNATURES
+#define ENTT_SIGNATURES 1
+#endif // ENTT_SIGNATURES
+
+
 
 #endif // ENTT_CONFIG_CONFIG_H
@@ -0,0 +1,408 @@
+#ifndef ENTT_CORE_MEMORY_HPP
+#define ENTT_CORE_MEMORY_HPP
+
+
+#include <new>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <cassert>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+
+
+namespace entt {
+
+
+/**
+ * @brief Base class for memory resources.
+ *
+ * A memory resource is an object that gives out raw memory on demand. It's
+ * used by allocators and containers to decide where their elements go.<br/>
+ * Derived classes must implement both the `allocate` and the `deallocate`
+ * member functions.
+ */
+class MemoryResource {
+public:
+    /*! @brief Default destructor. */
+    virtual ~MemoryResource() = default;
+
+    /**
+     * @brief Allocates a block of memory.
+     * @param size Size in bytes of the block to allocate.
+     * @param alignment Alignment of the block to allocate.
+     * @return A pointer to the newly allocated block of memory.
+     */
+    virtual void * allocate(const std::size_t size, const std::size_t alignment) = 0;
+
+    /**
+     * @brief Deallocates a block of memory.
+     * @param ptr A pointer to a block previously returned by `allocate`.
+     * @param size Size in bytes of the block to deallocate.
+     * @param alignment Alignment of the block to deallocate.
+     */
+    virtual void deallocate(void *ptr, const std::size_t size, const std::size_t alignment) = 0;
+};
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+inline void * allocate(MemoryResource *resource, const std::size_t size, const std::size_t alignment) {
+    if(resource) {
+        return resource->allocate(size, alignment);
+    } else if(alignment <= alignof(std::max_align_t)) {
+        return ::operator new(size);
+    }
+
+#if defined(__cpp_aligned_new)
+    return ::operator new(size, std::align_val_t{alignment});
+#else
+    // over-aligned types, room for the padding and the original pointer
+    auto *memory = static_cast<char *>(::operator new(size + alignment + sizeof(void *)));
+    auto *ptr = memory + sizeof(void *);
+    ptr += alignment - reinterpret_cast<std::uintptr_t>(ptr) % alignment;
+    std::memcpy(ptr - sizeof(void *), &memory, sizeof(void *));
+    return ptr;
+#endif
+}
+
+
+inline void deallocate(MemoryResource *resource, void *ptr, const std::size_t size, const std::size_t alignment) {
+    if(resource) {
+        resource->deallocate(ptr, size, alignment);
+    } else if(alignment <= alignof(std::max_align_t)) {
+        ::operator delete(ptr);
+    } else {
+#if defined(__cpp_aligned_new)
+        ::operator delete(ptr, std::align_val_t{alignment});
+#else
+        void *memory;
+        std::memcpy(&memory, static_cast<char *>(ptr) - sizeof(void *), sizeof(void *));
+        ::operator delete(memory);
+#endif
+    }
+}
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Monotonic memory resource.
+ *
+ * A monotonic resource gets large blocks of memory from an upstream resource
+ * (or the global operator new if none is provided) and gives them out in
+ * smaller pieces. Deallocating memory has no effect, all the memory is released
+ * at once either when the resource is destroyed or when `release` is invoked.
+ *
+ * It's suitable to back short-lived objects that allocate often and are freed
+ * all together, as an example a registry that represents a whole simulation
+ * world.
+ *
+ * @warning
+ * Objects that use a monotonic resource must be destroyed before to release the
+ * memory. Otherwise, attempting to use them results in undefined behavior.
+ */
+class MonotonicResource final: public MemoryResource {
+    struct Block {
+        Block *next;
+        std::size_t size;
+    };
+
+    static constexpr auto header = (sizeof(Block) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    void grow(const std::size_t size) {
+        const auto length = header + std::max(chunk, size);
+        auto *block = static_cast<Block *>(internal::allocate(upstream, length, alignof(std::max_align_t)));
+        block->next = head;
+        block->size = length;
+        head = block;
+        curr = reinterpret_cast<char *>(block) + header;
+        left = length - header;
+        chunk = chunk * 2;
+    }
+
+public:
+    /**
+     * @brief Constructs a monotonic resource.
+     * @param size Size in bytes of the first block of memory to get.
+     * @param resource An optional upstream resource, if any.
+     */
+    explicit MonotonicResource(const std::size_t size = 1024, MemoryResource *resource = nullptr) ENTT_NOEXCEPT
+        : upstream{resource}, chunk{size}, initial{size}
+    {}
+
+    /*! @brief Releases all the memory. */
+    ~MonotonicResource() {
+        release();
+    }
+
+    /*! @brief Copying a monotonic resource isn't allowed. */
+    MonotonicResource(const MonotonicResource &) = delete;
+    /*! @brief Copying a monotonic resource isn't allowed. @return This resource. */
+    MonotonicResource & operator=(const MonotonicResource &) = delete;
+
+    /**
+     * @brief Allocates a block of memory.
+     *
+     * Whenever the current block of memory is exhausted, a new and larger one
+     * is requested to the upstream resource.
+     *
+     * @param size Size in bytes of the block to allocate.
+     * @param alignment Alignment of the block to allocate.
+     * @return A pointer to the newly allocated block of memory.
+     */
+    void * allocate(const std::size_t size, const std::size_t alignment) override {
+        void *ptr = curr;
+
+        if(!std::align(alignment, size, ptr, left)) {
+            grow(size + alignment);
+            ptr = curr;
+            std::align(alignment, size, ptr, left);
+        }
+
+        curr = static_cast<char *>(ptr) + size;
+        left -= size;
+
+        return ptr;
+    }
+
+    /**
+     * @brief Deallocating memory is a no-op for a monotonic resource.
+     *
+     * Memory is released only when the resource is destroyed or `release` is
+     * invoked.
+     */
+    void deallocate(void *, const std::size_t, const std::size_t) override {}
+
+    /**
+     * @brief Releases all the memory at once.
+     *
+     * Blocks of memory are given back to the upstream resource. The next
+     * allocation starts from scratch.
+     */
+    void release() {
+        while(head) {
+            auto *next = head->next;
+            internal::deallocate(upstream, head, head->size, alignof(std::max_align_t));
+            head = next;
+        }
+
+        curr = nullptr;
+        left = {};
+        chunk = initial;
+    }
+
+    /**
+     * @brief Returns the upstream resource, if any.
+     * @return A pointer to the upstream resource, if any, a null pointer
+     * otherwise.
+     */
+    MemoryResource * resource() const ENTT_NOEXCEPT {
+        return upstream;
+    }
+
+private:
+    MemoryResource *upstream;
+    Block *head{nullptr};
+    void *curr{nullptr};
+    std::size_t left{};
+    std::size_t chunk;
+    const std::size_t initial;
+};
+
+
+/**
+ * @brief Allocator that forwards requests to a memory resource.
+ *
+ * Allocators of this type satisfy the requirements of standard containers. They
+ * are bound to a memory resource at construction and give memory out of it.
+ * Default constructed allocators aren't bound to any resource and rely on the
+ * global operators new and delete instead. Over-aligned types are supported in
+ * both cases.
+ *
+ * @tparam Type Type of objects to allocate.
+ */
+template<typename Type>
+class Allocator {
+    template<typename>
+    friend class Allocator;
+
+public:
+    /*! @brief Type of objects to allocate. */
+    using value_type = Type;
+
+    /*! @brief Default constructor, no resource is used. */
+    Allocator() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Constructs an allocator bound to the given resource.
+     * @param resource A memory resource, if any.
+     */
+    Allocator(MemoryResource *resource) ENTT_NOEXCEPT
+        : res{resource}
+    {}
+
+    /**
+     * @brief Constructs an allocator bound to the same resource of another
+     * allocator.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other An allocator of a different type.
+     */
+    template<typename Other>
+    Allocator(const Allocator<Other> &other) ENTT_NOEXCEPT
+        : res{other.res}
+    {}
+
+    /**
+     * @brief Allocates storage for the given number of objects.
+     * @param length Number of objects for which to allocate storage.
+     * @return A pointer to the newly allocated storage.
+     */
+    Type * allocate(const std::size_t length) {
+        return static_cast<Type *>(internal::allocate(res, length * sizeof(Type), alignof(Type)));
+    }
+
+    /**
+     * @brief Deallocates the given storage.
+     * @param ptr A pointer to a storage previously returned by `allocate`.
+     * @param length Number of objects for which storage was allocated.
+     */
+    void deallocate(Type *ptr, const std::size_t length) ENTT_NOEXCEPT {
+        internal::deallocate(res, ptr, length * sizeof(Type), alignof(Type));
+    }
+
+    /**
+     * @brief Returns the resource to which an allocator is bound, if any.
+     * @return A pointer to the memory resource, if any, a null pointer
+     * otherwise.
+     */
+    MemoryResource * resource() const ENTT_NOEXCEPT {
+        return res;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other An allocator with which to compare.
+     * @return True if the two allocators are bound to the same resource, false
+     * otherwise.
+     */
+    template<typename Other>
+    bool operator==(const Allocator<Other> &other) const ENTT_NOEXCEPT {
+        return res == other.res;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other An allocator with which to compare.
+     * @return False if the two allocators are bound to the same resource, true
+     * otherwise.
+     */
+    template<typename Other>
+    bool operator!=(const Allocator<Other> &other) const ENTT_NOEXCEPT {
+        return !(*this == other);
+    }
+
+private:
+    MemoryResource *res{nullptr};
+};
+
+
+/**
+ * @brief Deleter for objects created with `allocate_unique`.
+ *
+ * It destroys the object and gives its memory back to the resource from which
+ * it was obtained.
+ *
+ * @tparam Type Type of objects to delete.
+ */
+template<typename Type>
+class Deleter {
+    template<typename Other>
+    static void release(MemoryResource *resource, Type *ptr) {
+        auto *instance = static_cast<Other *>(ptr);
+        instance->~Other();
+        internal::deallocate(resource, instance, sizeof(Other), alignof(Other));
+    }
+
+public:
+    /*! @brief Default constructor. */
+    Deleter() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Constructs a deleter for objects of the given type.
+     * @tparam Other Actual type of the objects to delete.
+     * @param resource A memory resource, if any.
+     */
+    template<typename Other>
+    Deleter(MemoryResource *resource, Other *) ENTT_NOEXCEPT
+        : res{resource}, func{&release<Other>}
+    {}
+
+    /**
+     * @brief Destroys an object and releases its memory.
+     * @param ptr A pointer to the object to destroy.
+     */
+    void operator()(Type *ptr) const {
+        func(res, ptr);
+    }
+
+private:
+    MemoryResource *res{nullptr};
+    void(*func)(MemoryResource *, Type *){nullptr};
+};
+
+
+/**
+ * @brief Creates an object within the given resource and wraps it in a unique
+ * pointer.
+ *
+ * The object is created as an instance of `Other` but it's managed through a
+ * pointer to `Type`. Therefore `Other` must be either `Type` or a type that
+ * inherits from it.
+ *
+ * @tparam Type Type of objects managed by the unique pointer.
+ * @tparam Other Actual type of the object to create.
+ * @tparam Args Types of arguments to use to construct the object.
+ * @param resource A memory resource, if any.
+ * @param args Parameters to use to construct the object.
+ * @return A unique pointer to the newly created object.
+ */
+template<typename Type, typename Other = Type, typename... Args>
+std::unique_ptr<Type, Deleter<Type>> allocate_unique(MemoryResource *resource, Args &&... args) {
+    static_assert(std::is_base_of<Type, Other>::value, "!");
+    void *memory = internal::allocate(resource, sizeof(Other), alignof(Other));
+    Other *instance;
+
+    try {
+        instance = new (memory) Other(std::forward<Args>(args)...);
+    } catch(...) {
+        internal::deallocate(resource, memory, sizeof(Other), alignof(Other));
+        throw;
+    }
+
+    return std::unique_ptr<Type, Deleter<Type>>{instance, Deleter<Type>{resource, instance}};
+}
+
+
+}
+
+
+#endif // ENTT_CORE_MEMORY_HPP
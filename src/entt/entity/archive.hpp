@@ -0,0 +1,450 @@
+#ifndef ENTT_ENTITY_ARCHIVE_HPP
+#define ENTT_ENTITY_ARCHIVE_HPP
+
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <istream>
+#include <ostream>
+#include <cassert>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+
+
+namespace entt {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+inline bool little_endian() ENTT_NOEXCEPT {
+    const std::uint16_t probe = 1;
+    unsigned char byte;
+    std::memcpy(&byte, &probe, 1u);
+    return byte == 1u;
+}
+
+
+template<typename Type>
+using is_byte_ordered = std::integral_constant<bool, (std::is_arithmetic<Type>::value || std::is_enum<Type>::value) && (sizeof(Type) > 1u)>;
+
+
+template<typename Type>
+void reverse_bytes(Type &value) ENTT_NOEXCEPT {
+    auto *bytes = reinterpret_cast<unsigned char *>(&value);
+    std::reverse(bytes, bytes + sizeof(Type));
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Binary output archive.
+ *
+ * An output archive that can be used with snapshots (see Snapshot and
+ * DeltaSnapshot for more details). Values are appended to a growable memory
+ * buffer with plain copies, no type information is stored and there is no
+ * per-value dispatch:
+ *
+ * @code{.cpp}
+ * entt::OutputArchive output;
+ * registry.snapshot().entities(output).component<Position, Velocity>(entt::raw_t{}, output);
+ * send(output.data(), output.size());
+ * @endcode
+ *
+ * When bound to a stream, the buffer is written to the stream every time it
+ * exceeds a given threshold and when the archive is flushed or destroyed.
+ * Large arrays bypass the buffer and are written to the stream at once. The
+ * stream itself is never flushed by the archive.
+ *
+ * The layout is fixed and little-endian: arithmetic values and enums, entity
+ * identifiers included, are stored in little-endian order regardless of the
+ * platform. Any other type is stored as it is laid out in memory.
+ *
+ * @warning
+ * Only trivially copyable types can be serialized. Types that contain
+ * pointers or that are laid out differently on the two sides can't be
+ * exchanged safely.
+ */
+class OutputArchive final {
+    template<typename Type>
+    void write(const Type *value, const std::size_t length, std::true_type) {
+        if(internal::little_endian()) {
+            write(value, length, std::false_type{});
+        } else {
+            for(auto pos = length; pos; --pos) {
+                auto curr = *(value++);
+                internal::reverse_bytes(curr);
+                write(&curr, 1u, std::false_type{});
+            }
+        }
+    }
+
+    template<typename Type>
+    void write(const Type *value, const std::size_t length, std::false_type) {
+        static_assert(std::is_trivially_copyable<Type>::value, "!");
+        bytes(reinterpret_cast<const char *>(value), length * sizeof(Type));
+    }
+
+    void bytes(const char *data, const std::size_t size) {
+        if(stream && buffer.size() + size > threshold) {
+            flush();
+
+            if(!(size < threshold)) {
+                // large arrays are written directly, the buffer is empty
+                stream->write(data, size);
+                return;
+            }
+        }
+
+        buffer.insert(buffer.end(), data, data + size);
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor, data are kept in memory. */
+    OutputArchive() = default;
+
+    /**
+     * @brief Constructs an archive that writes data to a stream.
+     * @param stream A valid reference to an output stream.
+     * @param threshold Size in bytes that the buffer can reach before it's
+     * written to the stream.
+     */
+    explicit OutputArchive(std::ostream &stream, const size_type threshold = 1u << 20)
+        : buffer{},
+          stream{&stream},
+          threshold{threshold}
+    {
+        buffer.reserve(threshold);
+    }
+
+    /*! @brief Writes pending data to the stream, if any. */
+    ~OutputArchive() {
+        flush();
+    }
+
+    /*! @brief Copying an archive isn't allowed. */
+    OutputArchive(const OutputArchive &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The archive to move from.
+     */
+    OutputArchive(OutputArchive &&other) ENTT_NOEXCEPT
+        : buffer{std::move(other.buffer)},
+          stream{std::exchange(other.stream, nullptr)},
+          threshold{other.threshold}
+    {
+        other.buffer.clear();
+    }
+
+    /*! @brief Copying an archive isn't allowed. @return This archive. */
+    OutputArchive & operator=(const OutputArchive &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * Pending data are written to the stream, if any, before the archive is
+     * replaced.
+     *
+     * @param other The archive to move from.
+     * @return This archive.
+     */
+    OutputArchive & operator=(OutputArchive &&other) {
+        if(this != &other) {
+            flush();
+            buffer = std::move(other.buffer);
+            stream = std::exchange(other.stream, nullptr);
+            threshold = other.threshold;
+            other.buffer.clear();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Puts aside the given values, one after the other.
+     * @tparam Type Types of values to serialize.
+     * @param value Values to serialize.
+     */
+    template<typename... Type>
+    void operator()(const Type &... value) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (write(&value, 1u, internal::is_byte_ordered<Type>{}), 0)... };
+        (void)accumulator;
+    }
+
+    /**
+     * @brief Puts aside an array of values at once.
+     * @tparam Type Type of values to serialize.
+     * @tparam Length Integral type of the length of the array.
+     * @param first A pointer to the first element of the array.
+     * @param length Number of elements in the array.
+     */
+    template<typename Type, typename Length>
+    std::enable_if_t<std::is_integral<Length>::value>
+    operator()(Type *first, const Length length) {
+        write(static_cast<const std::remove_const_t<Type> *>(first), size_type(length), internal::is_byte_ordered<std::remove_const_t<Type>>{});
+    }
+
+    /**
+     * @brief Increases the capacity of the buffer.
+     * @param cap Desired capacity in bytes.
+     */
+    void reserve(const size_type cap) {
+        buffer.reserve(cap);
+    }
+
+    /**
+     * @brief Writes the content of the buffer to the stream, if any.
+     *
+     * The buffer is cleared once written. This function has no effect if the
+     * archive isn't bound to a stream.
+     */
+    void flush() {
+        if(stream && !buffer.empty()) {
+            stream->write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+
+    /**
+     * @brief Returns the number of bytes in the buffer.
+     * @return Number of bytes in the buffer.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return buffer.size();
+    }
+
+    /**
+     * @brief Direct access to the buffer.
+     *
+     * The returned pointer is such that range `[data(), data() + size()]` is
+     * always a valid range, even if the buffer is empty.
+     *
+     * @return A pointer to the first byte of the buffer.
+     */
+    const char * data() const ENTT_NOEXCEPT {
+        return buffer.data();
+    }
+
+    /**
+     * @brief Discards the content of the buffer.
+     *
+     * Memory isn't released, it's likely to be used again.
+     */
+    void clear() ENTT_NOEXCEPT {
+        buffer.clear();
+    }
+
+private:
+    std::vector<char> buffer;
+    std::ostream *stream{};
+    size_type threshold{};
+};
+
+
+/**
+ * @brief Binary input archive.
+ *
+ * An input archive that can be used with snapshot loaders (see SnapshotLoader
+ * and ContinuousLoader for more details). It reads data produced by an output
+ * archive either from memory or from a stream:
+ *
+ * @code{.cpp}
+ * entt::InputArchive input{data, size};
+ * registry.restore().entities(input).component<Position, Velocity>(entt::raw_t{}, input);
+ * @endcode
+ *
+ * Data in memory aren't copied, the archive reads them in place. When bound to
+ * a stream, data are read in large chunks into an internal buffer instead.
+ * Large arrays bypass the buffer and are read from the stream at once.
+ *
+ * Truncated data are a common error case, as an example when a file is
+ * damaged or a connection drops. An archive that runs out of data stops
+ * reading and zero-initializes the values that it can't restore entirely. It evaluates
+ * to false from then on and all the following reads have no effect:
+ *
+ * @code{.cpp}
+ * registry.restore().entities(input).component<Position>(input);
+ *
+ * if(!input) {
+ *     // the data were truncated
+ * }
+ * @endcode
+ */
+class InputArchive final {
+    template<typename Type>
+    void read(Type *value, const std::size_t length, std::true_type) {
+        read(value, length, std::false_type{});
+
+        if(!internal::little_endian()) {
+            std::for_each(value, value + length, [](auto &curr) { internal::reverse_bytes(curr); });
+        }
+    }
+
+    template<typename Type>
+    void read(Type *value, const std::size_t length, std::false_type) {
+        static_assert(std::is_trivially_copyable<Type>::value, "!");
+        bytes(reinterpret_cast<char *>(value), length * sizeof(Type));
+    }
+
+    bool refill() {
+        if(stream) {
+            buffer.resize(chunk);
+            stream->read(buffer.data(), chunk);
+            curr = buffer.data();
+            last = curr + stream->gcount();
+        }
+
+        return curr != last;
+    }
+
+    void bytes(char *data, std::size_t size) {
+        auto *first = data;
+        const auto length = size;
+
+        while(size && !failed) {
+            if(curr == last) {
+                if(stream && !(size < chunk)) {
+                    // large arrays are read directly, the buffer is empty
+                    stream->read(data, size);
+                    const auto count = size_type(stream->gcount());
+                    data += count;
+                    size -= count;
+                    failed = (size != 0u);
+                    break;
+                } else if(!refill()) {
+                    failed = true;
+                    break;
+                }
+            }
+
+            const auto count = std::min(size, size_type(last - curr));
+            std::memcpy(data, curr, count);
+            curr += count;
+            data += count;
+            size -= count;
+        }
+
+        if(failed) {
+            // values that couldn't be read entirely are zero-initialized
+            std::fill_n(first, length, char{});
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an archive that reads data from memory.
+     *
+     * @warning
+     * Data aren't copied, they must outlive the archive.
+     *
+     * @param data A pointer to the first byte to read.
+     * @param size Number of bytes available.
+     */
+    InputArchive(const char *data, const size_type size) ENTT_NOEXCEPT
+        : buffer{},
+          curr{data},
+          last{data + size},
+          stream{},
+          chunk{},
+          failed{}
+    {}
+
+    /**
+     * @brief Constructs an archive that reads data from a stream.
+     * @param stream A valid reference to an input stream.
+     * @param chunk Number of bytes to read from the stream at once.
+     */
+    explicit InputArchive(std::istream &stream, const size_type chunk = 1u << 20)
+        : buffer{},
+          curr{},
+          last{},
+          stream{&stream},
+          chunk{chunk},
+          failed{}
+    {
+        assert(chunk);
+    }
+
+    /*! @brief Copying an archive isn't allowed. */
+    InputArchive(const InputArchive &) = delete;
+    /*! @brief Default move constructor. */
+    InputArchive(InputArchive &&) = default;
+
+    /*! @brief Copying an archive isn't allowed. @return This archive. */
+    InputArchive & operator=(const InputArchive &) = delete;
+    /*! @brief Default move assignment operator. @return This archive. */
+    InputArchive & operator=(InputArchive &&) = default;
+
+    /**
+     * @brief Restores the given values, one after the other.
+     * @tparam Type Types of values to restore.
+     * @param value Values to restore.
+     */
+    template<typename... Type>
+    void operator()(Type &... value) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (read(&value, 1u, internal::is_byte_ordered<Type>{}), 0)... };
+        (void)accumulator;
+    }
+
+    /**
+     * @brief Restores an array of values at once.
+     * @tparam Type Type of values to restore.
+     * @tparam Length Integral type of the length of the array.
+     * @param first A pointer to the first element of the array.
+     * @param length Number of elements in the array.
+     */
+    template<typename Type, typename Length>
+    std::enable_if_t<std::is_integral<Length>::value>
+    operator()(Type *first, const Length length) {
+        read(first, size_type(length), internal::is_byte_ordered<Type>{});
+    }
+
+    /**
+     * @brief Checks if all the reads succeeded so far.
+     * @return False if the archive ran out of data, true otherwise.
+     */
+    explicit operator bool() const ENTT_NOEXCEPT {
+        return !failed;
+    }
+
+private:
+    std::vector<char> buffer;
+    const char *curr;
+    const char *last;
+    std::istream *stream;
+    size_type chunk;
+    bool failed;
+};
+
+
+}
+
+
+#endif // ENTT_ENTITY_ARCHIVE_HPP
@@ -0,0 +1,451 @@
+#ifndef ENTT_ENTITY_COMMAND_BUFFER_HPP
+#define ENTT_ENTITY_COMMAND_BUFFER_HPP
+
+
+#include <memory>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Command buffer.
+ *
+ * A command buffer records structural changes to apply to a registry at a
+ * later time, that is creations and destructions of entities and assignments,
+ * replacements and removals of components. Nothing reaches the registry until
+ * the buffer is played back.<br/>
+ * This makes it possible to request structural changes while iterating views
+ * and groups, even in parallel, as long as each thread records its commands
+ * in its own buffer:
+ *
+ * @code{.cpp}
+ * std::vector<entt::DefaultCommandBuffer> buffers(jobs.concurrency());
+ *
+ * registry.view<Health>().parallel_each(jobs, [&jobs, &buffers](auto entity, const auto &health) {
+ *     if(health.value <= 0) {
+ *         buffers[jobs.worker()].destroy(entity);
+ *     }
+ * });
+ *
+ * for(auto &&buffer: buffers) {
+ *     buffer.playback(registry);
+ * }
+ * @endcode
+ *
+ * Commands are recorded in compact byte streams, one per type of component,
+ * each entry made only of a tag and an identifier. Components are constructed
+ * immediately and kept aside in an array per type. During a playback, new
+ * entities are created all at once first. Then the streams are applied one type
+ * of component at a time, each of them in the order in which the commands were
+ * recorded and with consecutive assignments and removals batched together.
+ * Destructions are sorted and applied all at once at the end.<br/>
+ * Therefore commands that involve different types of components or the
+ * destruction of entities aren't applied in the order in which they were
+ * recorded and listeners are notified in a different order as well. As an
+ * example, a component assigned to an entity after its destruction has been
+ * recorded is still assigned and destroyed along with the entity.
+ *
+ * Commands that refer to entities that are no longer valid at the time of the
+ * playback are skipped. This is the case, for example, of entities destroyed
+ * by two buffers or by a buffer played back earlier.
+ *
+ * @note
+ * Entities created by means of a command buffer don't exist until the buffer
+ * is played back. Placeholders are returned instead and they can be used to
+ * assign components to the entities before they are created.
+ *
+ * @warning
+ * A command buffer isn't thread safe. Threads must record commands in
+ * different buffers.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class CommandBuffer final {
+    enum class Kind: unsigned char { ASSIGN, REPLACE, REMOVE };
+
+    // a tag followed by an identifier, the lowest bit of the tag marks placeholders
+    static constexpr std::size_t record_size = sizeof(unsigned char) + sizeof(Entity);
+
+    struct BasicLane {
+        virtual ~BasicLane() = default;
+        virtual void flush(CommandBuffer &, Registry<Entity> &) = 0;
+        virtual void clear() ENTT_NOEXCEPT = 0;
+
+        std::vector<unsigned char> stream;
+    };
+
+    template<typename Component>
+    struct Lane final: BasicLane {
+        void flush(CommandBuffer &buffer, Registry<Entity> &registry) override {
+            const auto &stream = BasicLane::stream;
+            auto payload = payloads.begin();
+
+            for(std::size_t pos{}, last = stream.size(); pos < last;) {
+                const auto kind = tag(stream[pos]);
+                auto next = pos + record_size;
+
+                while(next < last && tag(stream[next]) == kind) {
+                    next += record_size;
+                }
+
+                switch(kind) {
+                case Kind::ASSIGN:
+                    // consecutive assignments grow the pool at most once
+                    registry.template reserve<Component>(registry.template size<Component>() + (next - pos) / record_size);
+
+                    for(; pos < next; pos += record_size, ++payload) {
+                        const auto entity = buffer.resolve(&stream[pos]);
+
+                        if(registry.valid(entity)) {
+                            registry.template assign<Component>(entity, std::move(*payload));
+                        }
+                    }
+
+                    break;
+                case Kind::REPLACE:
+                    for(; pos < next; pos += record_size, ++payload) {
+                        const auto entity = buffer.resolve(&stream[pos]);
+
+                        if(registry.valid(entity)) {
+                            registry.template replace<Component>(entity, std::move(*payload));
+                        }
+                    }
+
+                    break;
+                case Kind::REMOVE:
+                    buffer.scratch.clear();
+
+                    for(; pos < next; pos += record_size) {
+                        const auto entity = buffer.resolve(&stream[pos]);
+
+                        if(registry.valid(entity)) {
+                            buffer.scratch.push_back(entity);
+                        }
+                    }
+
+                    registry.template remove<Component>(buffer.scratch.cbegin(), buffer.scratch.cend());
+                    break;
+                }
+            }
+        }
+
+        void clear() ENTT_NOEXCEPT override {
+            BasicLane::stream.clear();
+            payloads.clear();
+        }
+
+        std::vector<Component> payloads;
+    };
+
+    static Kind tag(const unsigned char header) ENTT_NOEXCEPT {
+        return Kind(header >> 1);
+    }
+
+    Entity resolve(const unsigned char *record) const ENTT_NOEXCEPT {
+        Entity entity;
+        std::memcpy(&entity, record + 1, sizeof(Entity));
+        assert(!(*record & 1u) || size_type(entity) < created.size());
+        return (*record & 1u) ? created[size_type(entity)] : entity;
+    }
+
+    template<typename Component>
+    Lane<Component> & lane() {
+        const auto ctype = Registry<Entity>::template type<Component>();
+
+        if(!(ctype < lanes.size())) {
+            lanes.resize(ctype + 1);
+        }
+
+        if(!lanes[ctype]) {
+            lanes[ctype] = std::make_unique<Lane<Component>>();
+        }
+
+        return static_cast<Lane<Component> &>(*lanes[ctype]);
+    }
+
+    template<typename Component, typename... Args>
+    static void construct(std::true_type, std::vector<Component> &payloads, Args &&... args) {
+        payloads.emplace_back(std::forward<Args>(args)...);
+    }
+
+    template<typename Component, typename... Args>
+    static void construct(std::false_type, std::vector<Component> &payloads, Args &&... args) {
+        payloads.push_back(Component{std::forward<Args>(args)...});
+    }
+
+    template<typename Component, typename... Args>
+    void record(const Kind kind, const bool placeholder, const Entity entity, Args &&... args) {
+        auto &curr = lane<Component>();
+
+        if(kind != Kind::REMOVE) {
+            construct<Component>(std::is_constructible<Component, Args...>{}, curr.payloads, std::forward<Args>(args)...);
+        }
+
+        const auto size = curr.stream.size();
+        curr.stream.resize(size + record_size);
+        curr.stream[size] = static_cast<unsigned char>((static_cast<unsigned char>(kind) << 1) | placeholder);
+        std::memcpy(&curr.stream[size + 1], &entity, sizeof(Entity));
+        ++count;
+    }
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = Registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Placeholder for an entity that doesn't exist yet.
+     *
+     * Placeholders are valid only for the command buffer that returned them
+     * and only until the buffer is either played back or cleared.
+     */
+    class Placeholder final {
+        friend class CommandBuffer;
+
+        Placeholder(const size_type index)
+            : index{index}
+        {}
+
+        size_type index;
+    };
+
+    /*! @brief Default constructor. */
+    CommandBuffer() = default;
+
+    /*! @brief Copying a command buffer isn't allowed. */
+    CommandBuffer(const CommandBuffer &) = delete;
+
+    /**
+     * @brief Move constructor.
+     *
+     * The other command buffer is left empty.
+     *
+     * @param other The instance to move from.
+     */
+    CommandBuffer(CommandBuffer &&other) ENTT_NOEXCEPT
+        : lanes{std::exchange(other.lanes, {})},
+          destroyed{std::exchange(other.destroyed, {})},
+          created{std::exchange(other.created, {})},
+          scratch{std::exchange(other.scratch, {})},
+          pending{std::exchange(other.pending, 0u)},
+          count{std::exchange(other.count, 0u)}
+    {}
+
+    /*! @brief Copying a command buffer isn't allowed. @return This command buffer. */
+    CommandBuffer & operator=(const CommandBuffer &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * The commands recorded so far are discarded and the other command buffer
+     * is left empty.
+     *
+     * @param other The instance to move from.
+     * @return This command buffer.
+     */
+    CommandBuffer & operator=(CommandBuffer &&other) ENTT_NOEXCEPT {
+        if(this != &other) {
+            lanes = std::exchange(other.lanes, {});
+            destroyed = std::exchange(other.destroyed, {});
+            created = std::exchange(other.created, {});
+            scratch = std::exchange(other.scratch, {});
+            pending = std::exchange(other.pending, 0u);
+            count = std::exchange(other.count, 0u);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the number of commands recorded so far.
+     * @return Number of commands recorded so far.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return count;
+    }
+
+    /**
+     * @brief Checks whether the command buffer is empty.
+     * @return True if no commands have been recorded, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return !count;
+    }
+
+    /**
+     * @brief Records the creation of an entity.
+     * @return A placeholder for the entity to create.
+     */
+    Placeholder create() {
+        ++count;
+        return Placeholder{pending++};
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     *
+     * Destroying an entity more than once through the same buffer has the
+     * same effect as destroying it once. Entities that are no longer valid at
+     * the time of the playback are ignored.
+     *
+     * @param entity A valid entity identifier.
+     */
+    void destroy(const entity_type entity) {
+        destroyed.push_back(entity);
+        ++count;
+    }
+
+    /**
+     * @brief Records the assignment of a component to an entity.
+     *
+     * The component is constructed immediately from the given arguments and
+     * moved into the registry during the playback.
+     *
+     * @tparam Component Type of component to create.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Component, typename... Args>
+    void assign(const entity_type entity, Args &&... args) {
+        record<Component>(Kind::ASSIGN, false, entity, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Records the assignment of a component to an entity that doesn't
+     * exist yet.
+     * @tparam Component Type of component to create.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param placeholder A valid placeholder returned by this buffer.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Component, typename... Args>
+    void assign(const Placeholder placeholder, Args &&... args) {
+        assert(placeholder.index < pending);
+        record<Component>(Kind::ASSIGN, true, entity_type(placeholder.index), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Records the replacement of the given component for an entity.
+     *
+     * The component is constructed immediately from the given arguments and
+     * moved into the registry during the playback.
+     *
+     * @tparam Component Type of component to replace.
+     * @tparam Args Types of arguments to use to construct the component.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to initialize the component.
+     */
+    template<typename Component, typename... Args>
+    void replace(const entity_type entity, Args &&... args) {
+        record<Component>(Kind::REPLACE, false, entity, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Records the removal of the given component from an entity.
+     * @tparam Component Type of component to remove.
+     * @param entity A valid entity identifier.
+     */
+    template<typename Component>
+    void remove(const entity_type entity) {
+        record<Component>(Kind::REMOVE, false, entity);
+    }
+
+    /**
+     * @brief Applies all the commands recorded so far to a registry.
+     *
+     * The command buffer is empty once the function returns and it can be
+     * reused to record other commands.
+     *
+     * The registry is flushed first, therefore entities reserved by means of
+     * `Registry::create(concurrent_t)` can be used freely in the commands.
+     *
+     * @warning
+     * Apart from the fact that commands that refer to entities no longer valid
+     * are skipped, commands must be valid for the registry at the time of the
+     * playback, exactly as if they were invoked directly on the registry in the
+     * order in which they are applied. Otherwise the behavior is undefined.
+     *
+     * @param registry A valid reference to a registry.
+     */
+    void playback(Registry<Entity> &registry) {
+        // identifiers reserved concurrently are valid from here on
+        registry.flush();
+        created.resize(pending);
+        registry.create(created.begin(), created.end());
+
+        for(auto &&curr: lanes) {
+            if(curr && !curr->stream.empty()) {
+                curr->flush(*this, registry);
+            }
+        }
+
+        // sorting makes the accesses to the pools more cache friendly
+        std::sort(destroyed.begin(), destroyed.end());
+        destroyed.erase(std::unique(destroyed.begin(), destroyed.end()), destroyed.end());
+
+        // entities already destroyed elsewhere (as an example, by other buffers) are skipped
+        destroyed.erase(std::remove_if(destroyed.begin(), destroyed.end(), [&registry](const auto entity) {
+            return !registry.valid(entity);
+        }), destroyed.end());
+
+        registry.destroy(destroyed.cbegin(), destroyed.cend());
+
+        clear();
+    }
+
+    /**
+     * @brief Discards all the commands recorded so far.
+     *
+     * Memory is kept around and reused for the next commands.
+     */
+    void clear() ENTT_NOEXCEPT {
+        for(auto &&curr: lanes) {
+            if(curr) {
+                curr->clear();
+            }
+        }
+
+        destroyed.clear();
+        created.clear();
+        pending = count = 0u;
+    }
+
+private:
+    std::vector<std::unique_ptr<BasicLane>> lanes{};
+    std::vector<entity_type> destroyed{};
+    std::vector<entity_type> created{};
+    std::vector<entity_type> scratch{};
+    size_type pending{};
+    size_type count{};
+};
+
+
+/**
+ * @brief Default command buffer class.
+ *
+ * The default command buffer is the best choice for almost all the
+ * applications.<br/>
+ * Users should have a really good reason to choose something different.
+ */
+using DefaultCommandBuffer = CommandBuffer<DefaultRegistry::entity_type>;
+
+
+}
+
+
+#endif // ENTT_ENTITY_COMMAND_BUFFER_HPP
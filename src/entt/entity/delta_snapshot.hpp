@@ -0,0 +1,228 @@
+#ifndef ENTT_ENTITY_DELTA_SNAPSHOT_HPP
+#define ENTT_ENTITY_DELTA_SNAPSHOT_HPP
+
+
+#include <array>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+#include "registry.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Utility class to create delta snapshots from a registry.
+ *
+ * A _delta snapshot_ contains only what changed since a given tick: the
+ * entities destroyed in the meantime, the components removed from the entities
+ * that are still alive and the components assigned, replaced or patched. It's
+ * meant to be restored with a continuous loader (see `ContinuousLoader::delta`
+ * for more details), so that the amount of data to send to a remote peer is
+ * proportional to the changes rather than to the size of the world:
+ *
+ * @code{.cpp}
+ * entt::DeltaSnapshot<entt::DefaultRegistry::entity_type, Position, Velocity> delta{registry};
+ *
+ * // at the end of each tick
+ * delta.serialize(last, output);
+ * last = registry.advance();
+ *
+ * // on the remote peer
+ * loader.delta<Position, Velocity>(input);
+ * @endcode
+ *
+ * Components that are assigned, replaced or patched are found through their
+ * change ticks, therefore change ticks must be requested for all the given
+ * types (see change_ticks for more details). Removals are recorded as they
+ * happen by listening to the destruction signals of the pools instead. Records
+ * are kept until they are discarded, so that peers that received the changes
+ * from different baselines can be served by the same object.
+ *
+ * @note
+ * Entities are said to be destroyed only if they owned at least one of the
+ * given components. Entities that never had any of them are never part of a
+ * delta snapshot.
+ *
+ * @warning
+ * Lifetime of a registry must overcome the one of the delta snapshots connected
+ * to it. In any other case, attempting to use a delta snapshot results in
+ * undefined behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Component Types of components to serialize.
+ */
+template<typename Entity, typename... Component>
+class DeltaSnapshot final {
+    static_assert(sizeof...(Component) > 0, "!");
+
+    using tick_type = typename Registry<Entity>::tick_type;
+    using record_type = std::pair<Entity, tick_type>;
+
+    template<std::size_t Index>
+    void removed(Registry<Entity> &, const Entity entity) {
+        records[Index].emplace_back(entity, registry->tick());
+    }
+
+    template<std::size_t... Indexes>
+    void connect(std::index_sequence<Indexes...>) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (registry->template destruction<Component>().template connect<DeltaSnapshot, &DeltaSnapshot::removed<Indexes>>(this), 0)... };
+        (void)accumulator;
+    }
+
+    template<typename Func>
+    std::vector<Entity> collect(const std::vector<record_type> &pending, const tick_type since, Func func) const {
+        // records are sorted by tick, the clock of a registry never goes backwards
+        auto first = std::lower_bound(pending.cbegin(), pending.cend(), since, [](const auto &record, const auto tick) {
+            return record.second < tick;
+        });
+
+        std::vector<Entity> entities;
+
+        for(; first != pending.cend(); ++first) {
+            if(func(first->first)) {
+                entities.push_back(first->first);
+            }
+        }
+
+        std::sort(entities.begin(), entities.end());
+        entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+        return entities;
+    }
+
+    template<typename Archive>
+    void entities(Archive &archive, const std::vector<Entity> &entities) const {
+        archive(static_cast<Entity>(entities.size()));
+
+        for(const auto entity: entities) {
+            archive(entity);
+        }
+    }
+
+    template<typename Type, typename Archive>
+    void changed(Archive &archive, const tick_type since) const {
+        static_assert(change_ticks<Type>::value, "!");
+        const auto view = registry->template view<Type>();
+        typename Registry<Entity>::size_type sz{};
+
+        view.each_changed_since(since, [&sz](const auto, const auto &) { ++sz; });
+        archive(static_cast<Entity>(sz));
+        view.each_changed_since(since, [&archive](const auto entity, const auto &instance) { archive(entity, instance); });
+    }
+
+    template<typename Archive, std::size_t... Indexes>
+    void serialize(Archive &archive, const tick_type since, std::index_sequence<Indexes...>) const {
+        std::vector<Entity> destroyed;
+
+        for(auto &&pending: records) {
+            const auto curr = collect(pending, since, [this](const auto entity) { return !registry->valid(entity); });
+            destroyed.insert(destroyed.end(), curr.cbegin(), curr.cend());
+        }
+
+        std::sort(destroyed.begin(), destroyed.end());
+        destroyed.erase(std::unique(destroyed.begin(), destroyed.end()), destroyed.end());
+        entities(archive, destroyed);
+
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (entities(archive, collect(records[Indexes], since, [this](const auto entity) {
+            return registry->valid(entity) && !registry->template has<Component>(entity);
+        })), changed<Component>(archive, since), 0)... };
+        (void)accumulator;
+    }
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = Registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+
+    /**
+     * @brief Constructs a delta snapshot that is bound to a given registry.
+     *
+     * Removals are recorded from now on. Changes made before the construction
+     * can still be found through change ticks.
+     *
+     * @param registry A valid reference to a registry.
+     */
+    explicit DeltaSnapshot(registry_type &registry)
+        : registry{&registry},
+          records{}
+    {
+        connect(std::index_sequence_for<Component...>{});
+    }
+
+    /*! @brief Disconnects the delta snapshot from its registry. */
+    ~DeltaSnapshot() {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (registry->template destruction<Component>().disconnect(this), 0)... };
+        (void)accumulator;
+    }
+
+    /*! @brief Copying a delta snapshot isn't allowed. */
+    DeltaSnapshot(const DeltaSnapshot &) = delete;
+    /*! @brief Moving a delta snapshot isn't allowed. */
+    DeltaSnapshot(DeltaSnapshot &&) = delete;
+
+    /*! @brief Copying a delta snapshot isn't allowed. @return This object. */
+    DeltaSnapshot & operator=(const DeltaSnapshot &) = delete;
+    /*! @brief Moving a delta snapshot isn't allowed. @return This object. */
+    DeltaSnapshot & operator=(DeltaSnapshot &&) = delete;
+
+    /**
+     * @brief Puts aside what changed since a given tick.
+     *
+     * The archive receives first the entities destroyed since the given tick,
+     * then for each component the entities from which it has been removed and
+     * the instances that have been stamped with a tick greater than or equal
+     * to the one provided, along with the entities to which they belong. As
+     * for snapshots, each set is preceded by its size.<br/>
+     * The concept of archive is the same used by the `Snapshot` class.
+     *
+     * @note
+     * Changes are returned at least once. Changes made during the given tick
+     * are put aside again by the deltas that start from it.
+     *
+     * @tparam Archive Type of output archive.
+     * @param since The tick from which to look for changes.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating delta snapshots.
+     */
+    template<typename Archive>
+    const DeltaSnapshot & serialize(const tick_type since, Archive &archive) const {
+        serialize(archive, since, std::index_sequence_for<Component...>{});
+        return *this;
+    }
+
+    /**
+     * @brief Discards the removals recorded before a given tick.
+     *
+     * Deltas that start from a tick older than the given one won't contain
+     * the removals that have been discarded. Usually, it's invoked with the
+     * oldest tick that peers have acknowledged.
+     *
+     * @param tick The tick before which records are no longer required.
+     */
+    void discard(const tick_type tick) {
+        for(auto &&pending: records) {
+            pending.erase(pending.begin(), std::lower_bound(pending.begin(), pending.end(), tick, [](const auto &record, const auto curr) {
+                return record.second < curr;
+            }));
+        }
+    }
+
+private:
+    registry_type *registry;
+    std::array<std::vector<record_type>, sizeof...(Component)> records;
+};
+
+
+}
+
+
+#endif // ENTT_ENTITY_DELTA_SNAPSHOT_HPP
@@ -0,0 +1,532 @@
+#ifndef ENTT_ENTITY_GROUP_HPP
+#define ENTT_ENTITY_GROUP_HPP
+
+
+#include <tuple>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+#include "entt_traits.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Forward declaration of the registry class.
+ */
+template<typename>
+class Registry;
+
+
+/**
+ * @brief Owning group.
+ *
+ * An owning group returns all the entities and only the entities that have at
+ * least the given components. Unlike views, a group owns the pools of its
+ * components: the registry keeps the entities that have all of them packed at
+ * the front of each pool and in the same order. Therefore iterating a group is
+ * a linear walk over a bunch of arrays and doesn't require any lookup.
+ *
+ * @b Important
+ *
+ * Iterators aren't invalidated if:
+ *
+ * * New instances of the given components are created and assigned to entities.
+ * * The entity currently pointed is modified (as an example, if one of the
+ *   given components is removed from the entity to which the iterator points).
+ *
+ * In all the other cases, modifying the pools of the given components in any
+ * way invalidates all the iterators and using them results in undefined
+ * behavior.
+ *
+ * @note
+ * Groups share references to the underlying data structures with the Registry
+ * that generated them. Therefore any change to the entities and to the
+ * components made by means of the registry are immediately reflected by
+ * groups.
+ *
+ * @warning
+ * Lifetime of a group must overcome the one of the registry that generated it.
+ * In any other case, attempting to use a group results in undefined behavior.
+ *
+ * @sa View
+ * @sa PersistentView
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Component Types of components owned by the group.
+ */
+template<typename Entity, typename... Component>
+class Group final {
+    static_assert(sizeof...(Component) > 1, "!");
+
+    /*! @brief A registry is allowed to create groups. */
+    friend class Registry<Entity>;
+
+    template<typename Comp>
+    using pool_type = SparseSet<Entity, Comp>;
+
+    template<typename Comp>
+    using component_iterator_type = typename pool_type<Comp>::const_iterator_type;
+
+    using view_type = SparseSet<Entity>;
+    using pattern_type = std::tuple<pool_type<Component> &...>;
+    using first_type = std::tuple_element_t<0, std::tuple<Component...>>;
+
+    // objects stored in columns aren't referenceable, they are accessed through their columns
+    template<typename... Comp>
+    using referenceable = std::is_same<
+        std::integer_sequence<bool, true, std::is_reference<typename pool_type<Comp>::reference_type>::value...>,
+        std::integer_sequence<bool, std::is_reference<typename pool_type<Comp>::reference_type>::value..., true>
+    >;
+
+    Group(const std::size_t &length, pool_type<Component> &... pools) ENTT_NOEXCEPT
+        : length{length}, pools{pools...}
+    {}
+
+    template<typename Comp>
+    const pool_type<Comp> & pool() const ENTT_NOEXCEPT {
+        return std::get<pool_type<Comp> &>(pools);
+    }
+
+    template<typename Comp>
+    component_iterator_type<Comp> cbegin() const ENTT_NOEXCEPT {
+        // entities of the group are at the front, iterators start from the back
+        return pool<Comp>().cbegin() + (pool<Comp>().size() - length);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename view_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename view_type::size_type;
+    /*! @brief Input iterator type. */
+    using iterator_type = typename view_type::iterator_type;
+    /*! @brief Constant input iterator type. */
+    using const_iterator_type = typename view_type::const_iterator_type;
+
+    /**
+     * @brief Returns the number of entities that have the given components.
+     * @return Number of entities that have the given components.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return length;
+    }
+
+    /**
+     * @brief Checks whether the group is empty.
+     * @return True if the group is empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return !length;
+    }
+
+    /**
+     * @brief Direct access to the list of entities.
+     *
+     * The returned pointer is such that range `[data(), data() + size()]` is
+     * always a valid range, even if the container is empty.
+     *
+     * @note
+     * There are no guarantees on the order of the entities. Use `begin` and
+     * `end` if you want to iterate the group in the expected order.
+     *
+     * @return A pointer to the array of entities.
+     */
+    const entity_type * data() const ENTT_NOEXCEPT {
+        return pool<first_type>().data();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity that has the given
+     * components.
+     *
+     * The returned iterator points to the first entity that has the given
+     * components. If the group is empty, the returned iterator will be equal
+     * to `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first entity that has the given components.
+     */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        const auto &view = static_cast<const view_type &>(pool<first_type>());
+        return view.cbegin() + (view.size() - length);
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity that has the given
+     * components.
+     *
+     * The returned iterator points to the first entity that has the given
+     * components. If the group is empty, the returned iterator will be equal
+     * to `end()`.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the first entity that has the given components.
+     */
+    inline const_iterator_type begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity that has the
+     * given components.
+     *
+     * The returned iterator points to the entity following the last entity that
+     * has the given components. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the entity following the last entity that has the
+     * given components.
+     */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        return static_cast<const view_type &>(pool<first_type>()).cend();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity that has the
+     * given components.
+     *
+     * The returned iterator points to the entity following the last entity that
+     * has the given components. Attempting to dereference the returned iterator
+     * results in undefined behavior.
+     *
+     * @note
+     * Input iterators stay true to the order imposed to the underlying data
+     * structures.
+     *
+     * @return An iterator to the entity following the last entity that has the
+     * given components.
+     */
+    inline const_iterator_type end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Returns a reference to the element at the given position.
+     * @param pos Position of the element to return.
+     * @return A reference to the requested element.
+     */
+    const entity_type & operator[](const size_type pos) const ENTT_NOEXCEPT {
+        return cbegin()[pos];
+    }
+
+    /**
+     * @brief Checks if a group contains an entity.
+     * @param entity A valid entity identifier.
+     * @return True if the group contains the given entity, false otherwise.
+     */
+    bool contains(const entity_type entity) const ENTT_NOEXCEPT {
+        const auto &view = static_cast<const view_type &>(pool<first_type>());
+        return view.has(entity) && view.get(entity) < length;
+    }
+
+    /**
+     * @brief Returns the component assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use an invalid component type results in a compilation
+     * error. Attempting to use an entity that doesn't belong to the group
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * group doesn't contain the given entity.
+     *
+     * @tparam Comp Type of component to get.
+     * @param entity A valid entity identifier.
+     * @return The component assigned to the entity.
+     */
+    template<typename Comp>
+    const Comp & get(const entity_type entity) const ENTT_NOEXCEPT {
+        static_assert(referenceable<Comp>::value, "!");
+        assert(contains(entity));
+        return pool<Comp>().get(entity);
+    }
+
+    /**
+     * @brief Returns the component assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use an invalid component type results in a compilation
+     * error. Attempting to use an entity that doesn't belong to the group
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * group doesn't contain the given entity.
+     *
+     * @tparam Comp Type of component to get.
+     * @param entity A valid entity identifier.
+     * @return The component assigned to the entity.
+     */
+    template<typename Comp>
+    inline Comp & get(const entity_type entity) ENTT_NOEXCEPT {
+        return const_cast<Comp &>(const_cast<const Group *>(this)->get<Comp>(entity));
+    }
+
+    /**
+     * @brief Returns the components assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use invalid component types results in a compilation error.
+     * Attempting to use an entity that doesn't belong to the group results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * group doesn't contain the given entity.
+     *
+     * @tparam Comp Types of the components to get.
+     * @param entity A valid entity identifier.
+     * @return The components assigned to the entity.
+     */
+    template<typename... Comp>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<const Comp &...>>
+    get(const entity_type entity) const ENTT_NOEXCEPT {
+        assert(contains(entity));
+        return std::tuple<const Comp &...>{get<Comp>(entity)...};
+    }
+
+    /**
+     * @brief Returns the components assigned to the given entity.
+     *
+     * Prefer this function instead of `Registry::get` during iterations. It has
+     * far better performance than its companion function.
+     *
+     * @warning
+     * Attempting to use invalid component types results in a compilation error.
+     * Attempting to use an entity that doesn't belong to the group results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * group doesn't contain the given entity.
+     *
+     * @tparam Comp Types of the components to get.
+     * @param entity A valid entity identifier.
+     * @return The components assigned to the entity.
+     */
+    template<typename... Comp>
+    inline std::enable_if_t<(sizeof...(Comp) > 1), std::tuple<Comp &...>>
+    get(const entity_type entity) ENTT_NOEXCEPT {
+        assert(contains(entity));
+        return std::tuple<Comp &...>{get<Comp>(entity)...};
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of const references to all the components of the
+     * group.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @note
+     * Pools are walked in parallel and no lookup is ever performed, this is the
+     * fastest way to iterate entities and components.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        static_assert(referenceable<Component...>::value, "!");
+        auto raw = std::make_tuple(cbegin<Component>()...);
+
+        for(auto first = cbegin(), last = cend(); first != last; ++first) {
+            func(*first, *(std::get<component_iterator_type<Component>>(raw)++)...);
+        }
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all the components of the
+     * group.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @note
+     * Pools are walked in parallel and no lookup is ever performed, this is the
+     * fastest way to iterate entities and components.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    inline void each(Func func) {
+        const_cast<const Group *>(this)->each([&func](const entity_type entity, const Component &... component) {
+            func(entity, const_cast<Component &>(component)...);
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The group is split in chunks that are processed in parallel by the given
+     * executor. The function object is invoked for each entity. It is provided
+     * with the entity itself and a set of const references to all the
+     * components of the group.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @sa JobSystem::parallel_for
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of entities per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    void parallel_each(Executor &executor, Func func, const size_type grain = {}) const {
+        static_assert(referenceable<Component...>::value, "!");
+        const auto begin = cbegin();
+        const auto raw = std::make_tuple(cbegin<Component>()...);
+
+        executor.parallel_for(length, grain, [&func, begin, raw](const auto first, const auto last) {
+            auto curr = std::make_tuple((std::get<component_iterator_type<Component>>(raw) + first)...);
+
+            std::for_each(begin + first, begin + last, [&func, &curr](const auto entity) {
+                func(entity, *(std::get<component_iterator_type<Component>>(curr)++)...);
+            });
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * Non-const version of the function above, the function object is
+     * provided with references to the components instead.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @sa parallel_each
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of entities per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    inline void parallel_each(Executor &executor, Func func, const size_type grain = {}) {
+        const_cast<const Group *>(this)->parallel_each(executor, [&func](const entity_type entity, const Component &... component) {
+            func(entity, const_cast<Component &>(component)...);
+        }, grain);
+    }
+
+    /**
+     * @brief Direct access to the column of a data member.
+     *
+     * Entities of a group are packed at the front of the pools it owns and in
+     * the same order. Therefore, the returned pointer is such that range
+     * `[column(member), column(member) + size()]` is always a valid range and
+     * the i-th element belongs to the i-th entity returned by `data`. Loops
+     * over columns of different components can be vectorized by the compiler:
+     *
+     * @code{.cpp}
+     * auto group = registry.group<Position, Velocity>();
+     * auto *px = group.column(&Position::x);
+     * const auto *vx = group.column(&Velocity::x);
+     *
+     * for(std::size_t pos = 0; pos < group.size(); ++pos) {
+     *     px[pos] += vx[pos] * dt;
+     * }
+     * @endcode
+     *
+     * @note
+     * This function is available only for components stored in columns (see
+     * column_storage for more details). Components stored in columns can't be
+     * accessed through `get`, `each` and `parallel_each`.
+     *
+     * @warning
+     * Attempting to get the column of a data member that isn't listed results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * data member isn't listed.
+     *
+     * @tparam Field Type of the data member.
+     * @tparam Object Type of component to which the data member belongs.
+     * @param member A pointer to the data member.
+     * @return A pointer to the column of the data member.
+     */
+    template<typename Field, typename Object>
+    const Field * column(Field Object:: *member) const ENTT_NOEXCEPT {
+        return pool<Object>().column(member);
+    }
+
+    /**
+     * @brief Direct access to the column of a data member.
+     *
+     * Entities of a group are packed at the front of the pools it owns and in
+     * the same order. Therefore, the returned pointer is such that range
+     * `[column(member), column(member) + size()]` is always a valid range and
+     * the i-th element belongs to the i-th entity returned by `data`.
+     *
+     * @note
+     * This function is available only for components stored in columns (see
+     * column_storage for more details).
+     *
+     * @warning
+     * Attempting to get the column of a data member that isn't listed results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * data member isn't listed.
+     *
+     * @tparam Field Type of the data member.
+     * @tparam Object Type of component to which the data member belongs.
+     * @param member A pointer to the data member.
+     * @return A pointer to the column of the data member.
+     */
+    template<typename Field, typename Object>
+    inline Field * column(Field Object:: *member) ENTT_NOEXCEPT {
+        return const_cast<Field *>(const_cast<const Group *>(this)->column(member));
+    }
+
+private:
+    const std::size_t &length;
+    const pattern_type pools;
+};
+
+
+}
+
+
+#endif // ENTT_ENTITY_GROUP_HPP
@@ -0,0 +1,524 @@
+#ifndef ENTT_ENTITY_MAPPED_SNAPSHOT_HPP
+#define ENTT_ENTITY_MAPPED_SNAPSHOT_HPP
+
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+#include "../core/ident.hpp"
+#include "archive.hpp"
+#include "entt_traits.hpp"
+#include "registry.hpp"
+#include "snapshot.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ENTT_MAPPED_FILE
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+namespace entt {
+
+
+/**
+ * @brief Snapshot laid out to be mapped in memory.
+ *
+ * A mapped snapshot is a binary image of a registry made of a fixed-size
+ * header followed by one section for the entities in use, one for the
+ * destroyed entities and two for each component, namely the array of entities
+ * and the array of instances. The header contains the offsets and the sizes of
+ * all the sections and each section starts at an offset that is a multiple of
+ * `ENTT_CACHE_LINE_SIZE`, so that arrays can be used in place once the image
+ * is mapped in memory:
+ *
+ * @code{.cpp}
+ * using snapshot_type = entt::MappedSnapshot<entt::DefaultRegistry::entity_type, Position, Velocity>;
+ *
+ * std::ofstream file{"world.bin", std::ios::binary};
+ * entt::OutputArchive output{file};
+ * snapshot_type::save(registry, output);
+ *
+ * // ...
+ *
+ * entt::MappedFile mapping{"world.bin"};
+ * snapshot_type{mapping.data(), mapping.size()}.load(registry);
+ * @endcode
+ *
+ * Loading a mapped snapshot doesn't parse the pools. Their arrays are copied
+ * as a whole from the image to the registry. Tools that only inspect a
+ * snapshot can also use the arrays in place without copying them at all (see
+ * `data` and `raw`).
+ *
+ * Images are validated when a mapped snapshot is constructed and when it's
+ * loaded. Damaged or truncated images are rejected, never used.
+ *
+ * @warning
+ * Only trivially copyable and default constructible components stored as
+ * plain arrays can be part of a mapped snapshot (see `stable_storage` and
+ * `column_storage` for more details). Images are little-endian and can be
+ * used only on little-endian platforms.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Component Types of components to serialize.
+ */
+template<typename Entity, typename... Component>
+class MappedSnapshot final {
+    using identifier_type = Identifier<Component...>;
+
+    static constexpr std::uint64_t magic = 0x50414e5354544e45; // ENTTSNAP
+    static constexpr std::uint64_t version = 1u;
+    static constexpr std::uint64_t alignment = ENTT_CACHE_LINE_SIZE;
+    static constexpr auto fields = 6u + 4u * sizeof...(Component);
+
+    struct Section final {
+        std::uint64_t count;
+        std::uint64_t entities;
+        std::uint64_t instances;
+    };
+
+    static std::uint64_t align(const std::uint64_t offset) ENTT_NOEXCEPT {
+        return (offset + alignment - 1u) / alignment * alignment;
+    }
+
+    template<typename Type>
+    static std::uint64_t section(const Registry<Entity> &registry, std::uint64_t &offset, std::array<std::uint64_t, fields> &header) {
+        static_assert(internal::is_bulk_serializable<Type>::value, "!");
+        static_assert(alignof(Type) <= alignment, "!");
+
+        const auto count = std::uint64_t(registry.template size<Type>());
+        auto *curr = header.data() + 6u + 4u * identifier_type::template get<Type>();
+
+        curr[0] = sizeof(Type);
+        curr[1] = count;
+        curr[2] = offset;
+        offset = align(offset + count * sizeof(Entity));
+        curr[3] = std::is_empty<Type>::value ? 0u : offset;
+        offset = std::is_empty<Type>::value ? offset : align(offset + count * sizeof(Type));
+
+        return count;
+    }
+
+    static void pad(OutputArchive &output, std::uint64_t &position, const std::uint64_t offset) {
+        static const char zeros[alignment]{};
+        assert(position <= offset && offset - position <= alignment);
+        output(zeros, offset - position);
+        position = offset;
+    }
+
+    template<typename Type>
+    static void write(const Registry<Entity> &registry, OutputArchive &output, std::uint64_t &position, const std::array<std::uint64_t, fields> &header) {
+        const auto *curr = header.data() + 6u + 4u * identifier_type::template get<Type>();
+
+        if(curr[1]) {
+            pad(output, position, curr[2]);
+            output(registry.template data<Type>(), curr[1]);
+            position += curr[1] * sizeof(Entity);
+
+            if(!std::is_empty<Type>::value) {
+                pad(output, position, curr[3]);
+                output(registry.template raw<Type>(), curr[1]);
+                position += curr[1] * sizeof(Type);
+            }
+        }
+    }
+
+    static bool fits(const char *data, const std::size_t size, const std::uint64_t offset, const std::uint64_t count, const std::size_t length, const std::size_t align) ENTT_NOEXCEPT {
+        // no arithmetic on untrusted values that can overflow
+        return offset <= size && count <= (size - offset) / length && !(reinterpret_cast<std::uintptr_t>(data + offset) % align);
+    }
+
+    bool check(const std::uint64_t offset, const std::size_t size, Section &section) const {
+        bool result = fits(image, size, offset, 1u, sizeof(Entity), alignof(Entity));
+
+        if(result) {
+            Entity count{};
+            InputArchive input{image + offset, sizeof(Entity)};
+            input(count);
+            section = Section{std::uint64_t(count), offset, 0u};
+            result = fits(image, size, offset + sizeof(Entity), section.count, sizeof(Entity), alignof(Entity));
+        }
+
+        return result;
+    }
+
+    template<typename Type>
+    bool check(const std::array<std::uint64_t, fields> &header, const std::size_t size) {
+        const auto *curr = header.data() + 6u + 4u * identifier_type::template get<Type>();
+        auto &section = sections[identifier_type::template get<Type>()];
+        bool result = (curr[0] == sizeof(Type));
+
+        if(result && curr[1]) {
+            result = fits(image, size, curr[2], curr[1], sizeof(Entity), alignof(Entity))
+                    && (std::is_empty<Type>::value || fits(image, size, curr[3], curr[1], sizeof(Type), alignof(Type)));
+            // offsets of empty sections aren't meaningful
+            section = Section{curr[1], curr[2], std::is_empty<Type>::value ? 0u : curr[3]};
+        }
+
+        return result;
+    }
+
+    template<typename Type>
+    bool check(const Registry<Entity> &registry, std::vector<bool> &owners) const {
+        const auto *first = data<Type>();
+        const auto *last = first + size<Type>();
+        owners.assign(registry.size(), false);
+
+        return std::all_of(first, last, [&registry, &owners](const auto entity) {
+            const auto entt = std::size_t(entity & entt_traits<Entity>::entity_mask);
+            const bool result = registry.valid(entity) && !owners[entt];
+
+            if(result) {
+                owners[entt] = true;
+            }
+
+            return result;
+        });
+    }
+
+    template<typename Type>
+    void load(Registry<Entity> &registry, std::true_type) const {
+        const auto *first = data<Type>();
+        registry.template assign<Type>(first, first + size<Type>());
+    }
+
+    template<typename Type>
+    void load(Registry<Entity> &registry, std::false_type) const {
+        const auto *first = data<Type>();
+        // instances are copied from the image to the pool all at once
+        registry.template assign<Type>(first, first + size<Type>(), raw<Type>());
+    }
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = Registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Puts aside an image of a registry.
+     *
+     * The image contains all the entities, either in use or destroyed, and
+     * the pools of the given components.
+     *
+     * @warning
+     * Offsets are relative to the first byte written. The archive shouldn't
+     * contain anything else before the image.
+     *
+     * @param registry A valid reference to a registry.
+     * @param output A valid reference to an output archive.
+     */
+    static void save(const registry_type &registry, OutputArchive &output) {
+        std::array<std::uint64_t, fields> header{};
+        std::uint64_t offset = align(fields * sizeof(std::uint64_t));
+
+        header[0] = magic;
+        header[1] = version;
+        header[2] = sizeof(Entity);
+        header[3] = sizeof...(Component);
+        header[4] = offset;
+        offset = align(offset + (registry.alive() + 1u) * sizeof(Entity));
+        header[5] = offset;
+        offset = align(offset + (registry.size() - registry.alive() + 1u) * sizeof(Entity));
+
+        using counts_type = std::uint64_t[];
+        counts_type counts = { 0u, section<Component>(registry, offset, header)... };
+        (void)counts;
+
+        output(header.data(), header.size());
+        std::uint64_t position = header.size() * sizeof(std::uint64_t);
+
+        // entities are stored in the same format used by snapshots
+        pad(output, position, header[4]);
+        registry.snapshot().entities(output);
+        position += (registry.alive() + 1u) * sizeof(Entity);
+        pad(output, position, header[5]);
+        registry.snapshot().destroyed(output);
+        position += (registry.size() - registry.alive() + 1u) * sizeof(Entity);
+
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (write<Component>(registry, output, position, header), 0)... };
+        (void)accumulator;
+    }
+
+    /**
+     * @brief Constructs a mapped snapshot from an image in memory.
+     *
+     * The image isn't copied, it must outlive the mapped snapshot. Usually, it
+     * comes from a file mapped in memory (see MappedFile for more details).
+     *
+     * Images are validated before they are used: the header must match the
+     * given list of components and all the sections must lie within the image
+     * and be correctly aligned. Invalid or truncated images aren't used at all
+     * and the mapped snapshot evaluates to false in this case.
+     *
+     * @param data A pointer to the first byte of the image.
+     * @param size Size of the image in bytes.
+     */
+    MappedSnapshot(const char *data, const size_type size)
+        : image{data},
+          alive{},
+          destroyed{},
+          sections{},
+          valid{}
+    {
+        std::array<std::uint64_t, fields> header{};
+
+        if(internal::little_endian() && !(size < sizeof(header))) {
+            InputArchive input{data, sizeof(header)};
+            input(header.data(), header.size());
+
+            valid = header[0] == magic
+                    && header[1] == version
+                    && header[2] == sizeof(Entity)
+                    && header[3] == sizeof...(Component)
+                    && check(header[4], size, alive)
+                    && check(header[5], size, destroyed);
+
+            using accumulator_type = bool[];
+            accumulator_type accumulator = { valid, (valid = valid && check<Component>(header, size))... };
+            (void)accumulator;
+        }
+
+        if(!valid) {
+            alive = destroyed = Section{};
+            sections = {};
+        }
+    }
+
+    /**
+     * @brief Checks if an image is valid.
+     * @return True if the image can be used, false otherwise.
+     */
+    explicit operator bool() const ENTT_NOEXCEPT {
+        return valid;
+    }
+
+    /**
+     * @brief Returns the number of entities of a given component.
+     * @tparam Type Type of component in which one is interested.
+     * @return Number of entities that have the given component.
+     */
+    template<typename Type>
+    size_type size() const ENTT_NOEXCEPT {
+        return size_type(sections[identifier_type::template get<Type>()].count);
+    }
+
+    /**
+     * @brief Direct access to the array of entities of a given component.
+     *
+     * The returned pointer refers to the image and is such that range
+     * `[data<Type>(), data<Type>() + size<Type>()]` is always a valid range.
+     *
+     * @tparam Type Type of component in which one is interested.
+     * @return A pointer to the array of entities.
+     */
+    template<typename Type>
+    const entity_type * data() const ENTT_NOEXCEPT {
+        return reinterpret_cast<const entity_type *>(image + sections[identifier_type::template get<Type>()].entities);
+    }
+
+    /**
+     * @brief Direct access to the array of instances of a given component.
+     *
+     * The returned pointer refers to the image and is such that range
+     * `[raw<Type>(), raw<Type>() + size<Type>()]` is always a valid range.<br/>
+     * The i-th instance belongs to the i-th entity returned by `data`.
+     *
+     * @warning
+     * Empty types aren't stored and this function isn't available for them.
+     *
+     * @tparam Type Type of component in which one is interested.
+     * @return A pointer to the array of instances.
+     */
+    template<typename Type>
+    const Type * raw() const ENTT_NOEXCEPT {
+        static_assert(!std::is_empty<Type>::value, "!");
+        return reinterpret_cast<const Type *>(image + sections[identifier_type::template get<Type>()].instances);
+    }
+
+    /**
+     * @brief Restores the image into a registry.
+     *
+     * All the data of the registry are discarded before the image is restored.
+     * Entities are given back the identifiers and versions they originally had
+     * and the pools of the given components are filled with one copy for each
+     * array.
+     *
+     * Entities that own components must be in use and can't appear twice in
+     * the same pool. The registry is left empty if this isn't the case or if
+     * the image isn't valid.
+     *
+     * @param registry A valid reference to a registry.
+     * @return True if the image has been restored, false otherwise.
+     */
+    bool load(registry_type &registry) const {
+        const auto loader = registry.restore();
+
+        if(valid) {
+            InputArchive in_use{image + alive.entities, (size_type(alive.count) + 1u) * sizeof(Entity)};
+            loader.entities(in_use);
+            InputArchive not_in_use{image + destroyed.entities, (size_type(destroyed.count) + 1u) * sizeof(Entity)};
+            loader.destroyed(not_in_use);
+
+            std::vector<bool> owners;
+            bool owned = true;
+
+            using accumulator_type = bool[];
+            accumulator_type accumulator = { owned, (owned = owned && check<Component>(registry, owners))... };
+            (void)accumulator;
+
+            if(owned) {
+                using accumulator_type = int[];
+                accumulator_type pools = { 0, (load<Component>(registry, std::is_empty<Component>{}), 0)... };
+                (void)pools;
+            } else {
+                registry.restore();
+            }
+
+            return owned;
+        }
+
+        return false;
+    }
+
+private:
+    const char *image;
+    Section alive;
+    Section destroyed;
+    std::array<Section, sizeof...(Component)> sections;
+    bool valid;
+};
+
+
+#ifdef ENTT_MAPPED_FILE
+
+
+/**
+ * @brief Read-only file mapped in memory.
+ *
+ * Pages are loaded lazily by the operating system when they are accessed for
+ * the first time, the file is never read as a whole up front.
+ *
+ * @note
+ * This class is available only on POSIX platforms. Elsewhere, files can be
+ * mapped with the tools offered by the platform and the images passed
+ * directly to the mapped snapshots.
+ */
+class MappedFile final {
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Maps a file in memory.
+     *
+     * In case of errors or if the file is empty, the object is left in an
+     * invalid state (see `operator bool`).
+     *
+     * @param path Path of the file to map.
+     */
+    explicit MappedFile(const char *path) ENTT_NOEXCEPT
+        : first{},
+          length{}
+    {
+        const auto fd = ::open(path, O_RDONLY);
+
+        if(fd != -1) {
+            struct stat info;
+
+            if(::fstat(fd, &info) == 0 && info.st_size > 0) {
+                auto *addr = ::mmap(nullptr, size_type(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if(addr != MAP_FAILED) {
+                    // images are usually read front to back
+                    ::posix_madvise(addr, size_type(info.st_size), POSIX_MADV_SEQUENTIAL);
+                    first = static_cast<const char *>(addr);
+                    length = size_type(info.st_size);
+                }
+            }
+
+            ::close(fd);
+        }
+    }
+
+    /*! @brief Unmaps the file, if any. */
+    ~MappedFile() {
+        if(first) {
+            ::munmap(const_cast<char *>(first), length);
+        }
+    }
+
+    /*! @brief Copying a mapped file isn't allowed. */
+    MappedFile(const MappedFile &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    MappedFile(MappedFile &&other) ENTT_NOEXCEPT
+        : first{std::exchange(other.first, nullptr)},
+          length{std::exchange(other.length, 0u)}
+    {}
+
+    /*! @brief Copying a mapped file isn't allowed. @return This object. */
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This object.
+     */
+    MappedFile & operator=(MappedFile &&other) ENTT_NOEXCEPT {
+        std::swap(first, other.first);
+        std::swap(length, other.length);
+        return *this;
+    }
+
+    /**
+     * @brief Checks if a file has been mapped in memory.
+     * @return True if the file has been mapped, false otherwise.
+     */
+    explicit operator bool() const ENTT_NOEXCEPT {
+        return first != nullptr;
+    }
+
+    /**
+     * @brief Direct access to the content of a file.
+     * @return A pointer to the first byte of the file.
+     */
+    const char * data() const ENTT_NOEXCEPT {
+        return first;
+    }
+
+    /**
+     * @brief Returns the size of a file.
+     * @return Size of the file in bytes.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return length;
+    }
+
+private:
+    const char *first;
+    size_type length;
+};
+
+
+#endif // ENTT_MAPPED_FILE
+
+
+}
+
+
+#endif // ENTT_ENTITY_MAPPED_SNAPSHOT_HPP
@@ -0,0 +1,321 @@
+#ifndef ENTT_ENTITY_OBSERVER_HPP
+#define ENTT_ENTITY_OBSERVER_HPP
+
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+#include "registry.hpp"
+#include "sparse_set.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Observer.
+ *
+ * An observer collects the entities that were affected by a given set of
+ * changes since the last time it was cleared. Entities are stored at most once
+ * and can be iterated the same way a view is iterated.<br/>
+ * Observers are built on the construction, the update and the destruction
+ * signals of the pools of components. Therefore systems that rely on them do
+ * an amount of work that is proportional to the changes rather than to the
+ * number of entities.
+ *
+ * Usually an observer is cleared by its consumer once the entities have been
+ * processed:
+ *
+ * @code{.cpp}
+ * entt::DefaultObserver observer{registry};
+ * observer.construction<Position, Velocity>().update<Position>();
+ *
+ * // ...
+ *
+ * for(const auto entity: observer) {
+ *     // ...
+ * }
+ *
+ * observer.clear();
+ * @endcode
+ *
+ * @note
+ * Entities aren't removed from an observer when they stop matching its rules
+ * or when they are destroyed. Users should test them if in doubt.
+ *
+ * @warning
+ * Lifetime of a registry must overcome the one of the observers connected to
+ * it. In any other case, attempting to use an observer results in undefined
+ * behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class Observer final {
+    using release_fn_type = void(Registry<Entity> &, Observer &);
+
+    template<typename Component>
+    static void release(Registry<Entity> &registry, Observer &observer, std::true_type) {
+        registry.template update<Component>().disconnect(&observer);
+    }
+
+    template<typename Component>
+    static void release(Registry<Entity> &, Observer &, std::false_type) {}
+
+    template<typename Component>
+    static void release(Registry<Entity> &registry, Observer &observer) {
+        registry.template construction<Component>().disconnect(&observer);
+        release<Component>(registry, observer, std::integral_constant<bool, !silent_update<Component>::value>{});
+        registry.template destruction<Component>().disconnect(&observer);
+    }
+
+    template<typename... Component>
+    void matching(Registry<Entity> &registry, const Entity entity) {
+        if(registry.template has<Component...>(entity)) {
+            touched(registry, entity);
+        }
+    }
+
+    void touched(Registry<Entity> &, const Entity entity) {
+        if(!entities.has(entity)) {
+            entities.construct(entity);
+        }
+    }
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = Registry<Entity>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename SparseSet<Entity>::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename SparseSet<Entity>::size_type;
+    /*! @brief Input iterator type. */
+    using iterator_type = typename SparseSet<Entity>::iterator_type;
+    /*! @brief Constant input iterator type. */
+    using const_iterator_type = typename SparseSet<Entity>::const_iterator_type;
+
+    /**
+     * @brief Constructs an observer that is bound to a given registry.
+     * @param registry A valid reference to a registry.
+     */
+    explicit Observer(Registry<Entity> &registry)
+        : registry{&registry}
+    {}
+
+    /*! @brief Disconnects the observer from its registry. */
+    ~Observer() {
+        disconnect();
+    }
+
+    /*! @brief Copying an observer isn't allowed. */
+    Observer(const Observer &) = delete;
+    /*! @brief Moving an observer isn't allowed. */
+    Observer(Observer &&) = delete;
+
+    /*! @brief Copying an observer isn't allowed. @return This observer. */
+    Observer & operator=(const Observer &) = delete;
+    /*! @brief Moving an observer isn't allowed. @return This observer. */
+    Observer & operator=(Observer &&) = delete;
+
+    /**
+     * @brief Collects the entities that start to have all the given
+     * components.
+     *
+     * An entity is collected whenever one of the given components is assigned
+     * to it and it has all the others at the same time.
+     *
+     * @tparam Component Types of components to observe.
+     * @return This observer.
+     */
+    template<typename... Component>
+    Observer & construction() {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (registry->template construction<Component>().template connect<Observer, &Observer::matching<Component...>>(this), releases.push_back(&release<Component>), 0)... };
+        (void)accumulator;
+        return *this;
+    }
+
+    /**
+     * @brief Collects the entities for which one of the given components is
+     * replaced.
+     * @tparam Component Types of components to observe.
+     * @return This observer.
+     */
+    template<typename... Component>
+    Observer & update() {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (registry->template update<Component>().template connect<Observer, &Observer::touched>(this), releases.push_back(&release<Component>), 0)... };
+        (void)accumulator;
+        return *this;
+    }
+
+    /**
+     * @brief Collects the entities from which one of the given components is
+     * removed.
+     * @tparam Component Types of components to observe.
+     * @return This observer.
+     */
+    template<typename... Component>
+    Observer & destruction() {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (registry->template destruction<Component>().template connect<Observer, &Observer::touched>(this), releases.push_back(&release<Component>), 0)... };
+        (void)accumulator;
+        return *this;
+    }
+
+    /**
+     * @brief Stops collecting entities.
+     *
+     * All the rules of the observer are discarded. Entities collected so far
+     * are still available until the observer is cleared.
+     */
+    void disconnect() {
+        for(auto *func: releases) {
+            func(*registry, *this);
+        }
+
+        releases.clear();
+    }
+
+    /**
+     * @brief Returns the number of entities collected so far.
+     * @return Number of entities collected so far.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return entities.size();
+    }
+
+    /**
+     * @brief Checks whether the observer is empty.
+     * @return True if the observer is empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return entities.empty();
+    }
+
+    /**
+     * @brief Direct access to the list of entities.
+     *
+     * The returned pointer is such that range `[data(), data() + size()]` is
+     * always a valid range, even if the container is empty.
+     *
+     * @return A pointer to the array of entities.
+     */
+    const entity_type * data() const ENTT_NOEXCEPT {
+        return entities.data();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity collected.
+     *
+     * The returned iterator points to the first entity collected. If the
+     * observer is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity collected.
+     */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        return entities.cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity collected.
+     *
+     * The returned iterator points to the first entity collected. If the
+     * observer is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity collected.
+     */
+    inline const_iterator_type begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity collected.
+     *
+     * The returned iterator points to the entity following the last entity
+     * collected. Attempting to dereference the returned iterator results in
+     * undefined behavior.
+     *
+     * @return An iterator to the entity following the last entity collected.
+     */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        return entities.cend();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity collected.
+     *
+     * The returned iterator points to the entity following the last entity
+     * collected. Attempting to dereference the returned iterator results in
+     * undefined behavior.
+     *
+     * @return An iterator to the entity following the last entity collected.
+     */
+    inline const_iterator_type end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Checks if an observer contains an entity.
+     * @param entity A valid entity identifier.
+     * @return True if the observer contains the given entity, false otherwise.
+     */
+    bool contains(const entity_type entity) const ENTT_NOEXCEPT {
+        return entities.has(entity);
+    }
+
+    /**
+     * @brief Iterates entities and applies the given function object to them.
+     *
+     * The function object is invoked for each entity collected so far.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        std::for_each(cbegin(), cend(), std::move(func));
+    }
+
+    /**
+     * @brief Discards all the entities collected so far.
+     *
+     * The rules of the observer are still in place and entities are collected
+     * again as soon as they change.
+     */
+    void clear() {
+        // pages are kept around, they are likely to be used again
+        for(auto pos = entities.size(); pos; --pos) {
+            entities.destroy(entities.data()[pos - 1]);
+        }
+    }
+
+private:
+    Registry<Entity> *registry;
+    SparseSet<Entity> entities;
+    std::vector<release_fn_type *> releases;
+};
+
+
+/**
+ * @brief Default observer class.
+ *
+ * The default observer is the best choice for almost all the
+ * applications.<br/>
+ * Users should have a really good reason to choose something different.
+ */
+using DefaultObserver = Observer<DefaultRegistry::entity_type>;
+
+
+}
+
+
+#endif // ENTT_ENTITY_OBSERVER_HPP
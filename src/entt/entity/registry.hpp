@@ -3,22 +3,26 @@
 
 
 #include <tuple>
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <utility>
 #include <cstddef>
 #include <cstdint>
 #include <cassert>
+#include <limits>
 #include <iterator>
 #include <algorithm>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/algorithm.hpp"
 #include "../core/family.hpp"
+#include "../core/memory.hpp"
 #include "../signal/sigh.hpp"
 #include "attachee.hpp"
 #include "entity.hpp"
 #include "entt_traits.hpp"
+#include "group.hpp"
 #include "snapshot.hpp"
 #include "sparse_set.hpp"
 #include "utility.hpp"
@@ -28,6 +32,30 @@
 namespace entt {
 
 
+/**
+ * @brief Opts a type of component out of the update signal.
+ *
+ * By default, the registry notifies listeners whenever a component is replaced
+ * or patched. Components that are updated very often and that no one is
+ * interested in can get rid of the signal by specializing this class.<br/>
+ * In this case, the sink returned by `Registry::update` isn't available and
+ * trying to get it results in a compilation error.
+ *
+ * As an example:
+ *
+ * @code{.cpp}
+ * namespace entt {
+ *     template<>
+ *     struct silent_update<Transform>: std::true_type {};
+ * }
+ * @endcode
+ *
+ * @tparam Type Type of component.
+ */
+template<typename Type>
+struct silent_update: std::false_type {};
+
+
 /**
  * @brief Fast and reliable entity-component system.
  *
@@ -36,6 +64,15 @@ namespace entt {
  * By means of a registry, users can manage entities and components and thus
  * create views to iterate them.
  *
+ * @note
+ * The registry keeps a signature for each entity, that is a bitset with one
+ * bit per type of component. Signatures make `has`, `orphan` and `destroy`
+ * independent from the number of types of components. They take up
+ * `8 * W * N` bytes, where `N` is the number of entities and `W` is the number
+ * of types of components divided by 64 and rounded up.<br/>
+ * Signatures can be disabled by defining `ENTT_SIGNATURES` to `0` before
+ * including the registry. In this case, the pools are queried in turn.
+ *
  * @tparam Entity A valid entity type (see entt_traits for more details).
  */
 template<typename Entity>
@@ -43,25 +80,95 @@ class Registry {
     using tag_family = Family<struct InternalRegistryTagFamily>;
     using component_family = Family<struct InternalRegistryComponentFamily>;
     using handler_family = Family<struct InternalRegistryHandlerFamily>;
+    using group_family = Family<struct InternalRegistryGroupFamily>;
     using signal_type = SigH<void(Registry &, const Entity)>;
     using traits_type = entt_traits<Entity>;
 
+    template<typename Type>
+    using owner_type = std::unique_ptr<Type, Deleter<Type>>;
+
+    template<typename Type>
+    using container_type = std::vector<Type, Allocator<Type>>;
+
+    using word_type = std::uint64_t;
+    static constexpr auto word_size = std::numeric_limits<word_type>::digits;
+    static constexpr bool signed_entities = (ENTT_SIGNATURES != 0);
+
     template<typename Component>
     struct Pool: SparseSet<Entity, Component> {
-        Pool(Registry *registry) ENTT_NOEXCEPT
-            : registry{registry}
+        Pool(Registry *registry, MemoryResource *resource) ENTT_NOEXCEPT
+            : SparseSet<Entity, Component>{resource}, registry{registry}, ctype{component_family::type<Component>()}
         {}
 
         template<typename... Args>
-        Component & construct(const Entity entity, Args &&... args) {
-            auto &component = SparseSet<Entity, Component>::construct(entity, std::forward<Args>(args)...);
+        decltype(auto) construct(const Entity entity, Args &&... args) {
+            decltype(auto) component = SparseSet<Entity, Component>::construct(entity, std::forward<Args>(args)...);
+            touch(entity, change_ticks<Component>{});
+            registry->mark(entity, ctype);
+            hctor.publish(*registry, entity);
             ctor.publish(*registry, entity);
             return component;
         }
 
+        template<typename It, typename Arg>
+        std::enable_if_t<std::is_same<std::decay_t<decltype(*std::declval<It>())>, Entity>::value>
+        construct(It first, It last, Arg &&arg) {
+            SparseSet<Entity, Component>::construct(first, last, std::forward<Arg>(arg));
+
+            std::for_each(first, last, [this](const auto entity) {
+                touch(entity, change_ticks<Component>{});
+                registry->mark(entity, ctype);
+            });
+
+            if(!hctor.empty() || !ctor.empty()) {
+                // listeners are notified once all the components are in place
+                std::for_each(first, last, [this](const auto entity) {
+                    hctor.publish(*registry, entity);
+                    ctor.publish(*registry, entity);
+                });
+            }
+        }
+
+        template<typename... Args>
+        decltype(auto) replace(const Entity entity, Args &&... args) {
+            decltype(auto) component = SparseSet<Entity, Component>::replace(entity, std::forward<Args>(args)...);
+            updated(entity);
+            return component;
+        }
+
+        template<typename Func>
+        decltype(auto) patch(const Entity entity, Func func) {
+            decltype(auto) component = SparseSet<Entity, Component>::patch(entity, std::move(func));
+            updated(entity);
+            return component;
+        }
+
         void destroy(const Entity entity) override {
             dtor.publish(*registry, entity);
+            hdtor.publish(*registry, entity);
             SparseSet<Entity, Component>::destroy(entity);
+            registry->unmark(entity, ctype);
+        }
+
+        template<typename It>
+        void destroy(It first, It last) {
+            if(!dtor.empty() || !hdtor.empty()) {
+                // listeners are notified while all the components are still in place
+                std::for_each(first, last, [this](const auto entity) {
+                    dtor.publish(*registry, entity);
+                    hdtor.publish(*registry, entity);
+                });
+            }
+
+            SparseSet<Entity, Component>::template destroy<It>(first, last);
+
+            std::for_each(first, last, [this](const auto entity) {
+                registry->unmark(entity, ctype);
+            });
+        }
+
+        void destroy(const Entity *first, const Entity *last) override {
+            destroy<const Entity *>(first, last);
         }
 
         typename signal_type::sink_type construction() ENTT_NOEXCEPT {
@@ -72,10 +179,66 @@ class Registry {
             return dtor.sink();
         }
 
+        typename signal_type::sink_type update() ENTT_NOEXCEPT {
+            return updt.sink();
+        }
+
+        void copy(const Pool &other) {
+            copy(other, std::is_copy_constructible<Component>{});
+            // listeners of users belong to the registry, only handlers are copied
+            hctor = other.hctor;
+            hdtor = other.hdtor;
+            owned = other.owned;
+        }
+
+        void clear() {
+            SparseSet<Entity, Component>::reset();
+            hctor = {};
+            hdtor = {};
+            owned = false;
+        }
+
+        void bind(Registry *owner) ENTT_NOEXCEPT {
+            registry = owner;
+        }
+
+        // handlers of groups and persistent views, kept apart from listeners
+        signal_type hctor;
+        signal_type hdtor;
+        // pools owned by a group can't be sorted nor owned by other groups
+        bool owned{};
+
     private:
+        void copy(const Pool &other, std::true_type) {
+            SparseSet<Entity, Component>::copy(other);
+        }
+
+        void copy(const Pool &other, std::false_type) {
+            // pools of components that cannot be copied can be cloned only if empty
+            assert(other.empty());
+            (void)other;
+            SparseSet<Entity, Component>::reset();
+        }
+
+        void touch(const Entity entity, std::true_type) ENTT_NOEXCEPT {
+            SparseSet<Entity, Component>::stamp(entity, registry->clock);
+        }
+
+        void touch(const Entity, std::false_type) ENTT_NOEXCEPT {}
+
+        void updated(const Entity entity) {
+            touch(entity, change_ticks<Component>{});
+
+            if(!silent_update<Component>::value) {
+                updt.publish(*registry, entity);
+            }
+        }
+
         Registry *registry;
+        const std::size_t ctype;
         signal_type ctor;
         signal_type dtor;
+        signal_type updt;
     };
 
     template<typename Tag>
@@ -112,25 +275,176 @@ class Registry {
             return dtor.sink();
         }
 
+        void copy(const Attaching &other) {
+            clear();
+
+            if(static_cast<const Attachee<Entity> &>(other).get() != null) {
+                Attachee<Entity, Tag>::construct(static_cast<const Attachee<Entity> &>(other).get(), other.get());
+            }
+        }
+
+        void clear() {
+            if(Attachee<Entity>::get() != null) {
+                // listeners aren't notified, the tag is overwritten
+                Attachee<Entity, Tag>::destroy();
+            }
+        }
+
+        void bind(Registry *owner) ENTT_NOEXCEPT {
+            registry = owner;
+        }
+
     private:
         Registry *registry;
         signal_type ctor;
         signal_type dtor;
     };
 
-    template<typename handler_family::family_type(*Type)(), typename... Component>
+    using clone_fn_type = void(const Registry &, Registry &);
+    using clone_tag_fn_type = void(tag_t, const Registry &, Registry &);
+    using bind_fn_type = void(Registry &);
+    using bind_tag_fn_type = void(tag_t, Registry &);
+
+    template<typename Component>
+    static void cloning(const Registry &from, Registry &to) {
+        to.assure<Component>();
+        auto &cpool = to.pool<Component>();
+        from.managed<Component>() ? cpool.copy(from.pool<Component>()) : cpool.clear();
+    }
+
+    template<typename Tag>
+    static void cloning(tag_t, const Registry &from, Registry &to) {
+        to.assure<Tag>(tag_t{});
+        auto &tag = to.pool<Tag>(tag_t{});
+        from.managed<Tag>(tag_t{}) ? tag.copy(from.pool<Tag>(tag_t{})) : tag.clear();
+    }
+
+    template<typename Component>
+    static void binding(Registry &registry) {
+        registry.pool<Component>().bind(&registry);
+    }
+
+    template<typename Tag>
+    static void binding(tag_t, Registry &registry) {
+        registry.pool<Tag>(tag_t{}).bind(&registry);
+    }
+
+    void rebind() ENTT_NOEXCEPT {
+        // pools and tags refer to the registry that owns them, moves must update them
+        for(auto pos = binders.size(); pos; --pos) {
+            if(binders[pos-1]) {
+                binders[pos-1](*this);
+            }
+        }
+
+        for(auto pos = tbinders.size(); pos; --pos) {
+            if(tbinders[pos-1]) {
+                tbinders[pos-1](tag_t{}, *this);
+            }
+        }
+    }
+
+    template<typename handler_family::family_type(*Type)(), typename Filter, typename... Component>
     static void creating(Registry &registry, const Entity entity) {
-        if(registry.has<Component...>(entity)) {
+        if(registry.has<Component...>(entity) && !registry.excluded(Filter{}, entity)) {
             registry.handlers[Type()]->construct(entity);
         }
     }
 
-    template<typename... Component>
+    template<typename handler_family::family_type(*Type)()>
     static void destroying(Registry &registry, const Entity entity) {
-        auto &handler = *registry.handlers[handler_family::type<Component...>()];
+        auto &handler = *registry.handlers[Type()];
         return handler.has(entity) ? handler.destroy(entity) : void();
     }
 
+    template<typename handler_family::family_type(*Type)(), typename Removed, typename Filter, typename... Component>
+    static void restoring(Registry &registry, const Entity entity) {
+        // listeners are notified before components are removed
+        if(registry.has<Component...>(entity) && !registry.excluded<Removed>(Filter{}, entity)) {
+            registry.handlers[Type()]->construct(entity);
+        }
+    }
+
+    struct Grouping {
+        std::size_t length{};
+    };
+
+    template<typename... Component>
+    static void grouping(Registry &registry, const Entity entity) {
+        if(registry.has<Component...>(entity)) {
+            auto &length = registry.groups[group_family::type<Component...>()]->length;
+            registry.arrange<Component...>(entity, length++);
+        }
+    }
+
+    template<typename... Component>
+    static void ungrouping(Registry &registry, const Entity entity) {
+        // listeners are notified before components are removed
+        if(registry.has<Component...>(entity)) {
+            auto &length = registry.groups[group_family::type<Component...>()]->length;
+            registry.arrange<Component...>(entity, --length);
+        }
+    }
+
+    static std::size_t highest(word_type word) ENTT_NOEXCEPT {
+        std::size_t bit{};
+
+        for(auto shift = word_size / 2; shift; shift /= 2) {
+            if(word >> shift) {
+                word >>= shift;
+                bit += shift;
+            }
+        }
+
+        return bit;
+    }
+
+    void mark(const Entity entity, const std::size_t ctype) {
+        if(signed_entities) {
+            const auto pos = std::size_t(entity & traits_type::entity_mask) * words + ctype / word_size;
+
+            if(!(pos < signatures.size())) {
+                // signatures are allocated lazily, all the bits are unset by default
+                signatures.resize(entities.size() * words);
+            }
+
+            signatures[pos] |= word_type{1} << (ctype % word_size);
+        }
+    }
+
+    void unmark(const Entity entity, const std::size_t ctype) ENTT_NOEXCEPT {
+        if(signed_entities) {
+            const auto pos = std::size_t(entity & traits_type::entity_mask) * words + ctype / word_size;
+            signatures[pos] &= ~(word_type{1} << (ctype % word_size));
+        }
+    }
+
+    bool marked(const Entity entity, const std::size_t ctype) const ENTT_NOEXCEPT {
+        const auto pos = std::size_t(entity & traits_type::entity_mask) * words + ctype / word_size;
+
+        return signed_entities
+                ? (ctype < words * word_size && pos < signatures.size() && (signatures[pos] & (word_type{1} << (ctype % word_size))))
+                : (ctype < pools.size() && pools[ctype] && pools[ctype]->has(entity));
+    }
+
+    void widen(const std::size_t length) {
+        container_type<word_type> other(entities.size() * length, word_type{}, signatures.get_allocator());
+
+        for(std::size_t entt = 0, last = words ? signatures.size() / words : std::size_t{}; entt < last; ++entt) {
+            std::copy_n(signatures.data() + entt * words, words, other.data() + entt * length);
+        }
+
+        signatures = std::move(other);
+        words = length;
+    }
+
+    template<typename... Component>
+    void arrange(const Entity entity, const std::size_t pos) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (pool<Component>().swap(static_cast<SparseSet<Entity> &>(pool<Component>()).get(entity), pos), 0)... };
+        (void)accumulator;
+    }
+
     template<typename Tag>
     inline bool managed(tag_t) const ENTT_NOEXCEPT {
         const auto ttype = tag_family::type<Tag>();
@@ -165,44 +479,53 @@ class Registry {
         return const_cast<Pool<Component> &>(const_cast<const Registry *>(this)->pool<Component>());
     }
 
-    template<typename Comp, std::size_t Pivot, typename... Component, std::size_t... Indexes>
+    template<typename Comp, std::size_t Pivot, typename Filter, typename... Component, std::size_t... Indexes>
     void connect(std::index_sequence<Indexes...>) {
-        pool<Comp>().construction().template connect<&Registry::creating<&handler_family::type<Component...>, std::tuple_element_t<(Indexes < Pivot ? Indexes : (Indexes+1)), std::tuple<Component...>>...>>();
-        pool<Comp>().destruction().template connect<&Registry::destroying<Component...>>();
+        pool<Comp>().hctor.sink().template connect<&Registry::creating<&handler_family::type<Filter, Component...>, Filter, std::tuple_element_t<(Indexes < Pivot ? Indexes : (Indexes+1)), std::tuple<Component...>>...>>();
+        pool<Comp>().hdtor.sink().template connect<&Registry::destroying<&handler_family::type<Filter, Component...>>>();
     }
 
-    template<typename... Component, std::size_t... Indexes>
-    void connect(std::index_sequence<Indexes...>) {
+    template<typename... Component, typename... Exclude, std::size_t... Indexes>
+    void connect(exclude_t<Exclude...>, std::index_sequence<Indexes...>) {
+        using filter_type = exclude_t<Exclude...>;
         using accumulator_type = int[];
-        accumulator_type accumulator = { (assure<Component>(), connect<Component, Indexes, Component...>(std::make_index_sequence<sizeof...(Component)-1>{}), 0)... };
+        accumulator_type accumulator = { (assure<Component>(), connect<Component, Indexes, filter_type, Component...>(std::make_index_sequence<sizeof...(Component)-1>{}), 0)... };
+        // excluded components work the other way around
+        accumulator_type filter = { 0, (assure<Exclude>(),
+            pool<Exclude>().hctor.sink().template connect<&Registry::destroying<&handler_family::type<filter_type, Component...>>>(),
+            pool<Exclude>().hdtor.sink().template connect<&Registry::restoring<&handler_family::type<filter_type, Component...>, Exclude, filter_type, Component...>>(),
+        0)... };
         (void)accumulator;
+        (void)filter;
     }
 
-    template<typename Comp, std::size_t Pivot, typename... Component, std::size_t... Indexes>
+    template<typename Comp, std::size_t Pivot, typename Filter, typename... Component, std::size_t... Indexes>
     void disconnect(std::index_sequence<Indexes...>) {
-        pool<Comp>().construction().template disconnect<&Registry::creating<&handler_family::type<Component...>, std::tuple_element_t<(Indexes < Pivot ? Indexes : (Indexes+1)), std::tuple<Component...>>...>>();
-        pool<Comp>().destruction().template disconnect<&Registry::destroying<Component...>>();
+        pool<Comp>().hctor.sink().template disconnect<&Registry::creating<&handler_family::type<Filter, Component...>, Filter, std::tuple_element_t<(Indexes < Pivot ? Indexes : (Indexes+1)), std::tuple<Component...>>...>>();
+        pool<Comp>().hdtor.sink().template disconnect<&Registry::destroying<&handler_family::type<Filter, Component...>>>();
     }
 
-    template<typename... Component, std::size_t... Indexes>
-    void disconnect(std::index_sequence<Indexes...>) {
+    template<typename... Component, typename... Exclude, std::size_t... Indexes>
+    void disconnect(exclude_t<Exclude...>, std::index_sequence<Indexes...>) {
+        using filter_type = exclude_t<Exclude...>;
         using accumulator_type = int[];
         // if a set exists, pools have already been created for it
-        accumulator_type accumulator = { (disconnect<Component, Indexes, Component...>(std::make_index_sequence<sizeof...(Component)-1>{}), 0)... };
+        accumulator_type accumulator = { (disconnect<Component, Indexes, filter_type, Component...>(std::make_index_sequence<sizeof...(Component)-1>{}), 0)... };
+        accumulator_type filter = { 0, (
+            pool<Exclude>().hctor.sink().template disconnect<&Registry::destroying<&handler_family::type<filter_type, Component...>>>(),
+            pool<Exclude>().hdtor.sink().template disconnect<&Registry::restoring<&handler_family::type<filter_type, Component...>, Exclude, filter_type, Component...>>(),
+        0)... };
         (void)accumulator;
+        (void)filter;
     }
 
-    template<typename Component>
-    void assure() {
-        const auto ctype = component_family::type<Component>();
-
-        if(!(ctype < pools.size())) {
-            pools.resize(ctype + 1);
-        }
-
-        if(!pools[ctype]) {
-            pools[ctype] = std::make_unique<Pool<Component>>(this);
-        }
+    template<typename Removed = void, typename... Exclude>
+    bool excluded(exclude_t<Exclude...>, const Entity entity) const ENTT_NOEXCEPT {
+        bool any = false;
+        using accumulator_type = bool[];
+        accumulator_type accumulator = { any, (any = any || (!std::is_same<Removed, Exclude>::value && marked(entity, component_family::type<Exclude>())))... };
+        (void)accumulator;
+        return any;
     }
 
     template<typename Tag>
@@ -211,13 +534,61 @@ class Registry {
 
         if(!(ttype < tags.size())) {
             tags.resize(ttype + 1);
+            tcloners.resize(ttype + 1);
+            tbinders.resize(ttype + 1);
         }
 
         if(!tags[ttype]) {
-            tags[ttype] = std::make_unique<Attaching<Tag>>(this);
+            tags[ttype] = allocate_unique<Attachee<Entity>, Attaching<Tag>>(tags.get_allocator().resource(), this);
+            tcloners[ttype] = &Registry::cloning<Tag>;
+            tbinders[ttype] = &Registry::binding<Tag>;
         }
     }
 
+    template<typename Component>
+    void copy(const Registry &from) {
+        assure<Component>();
+        const auto ctype = component_family::type<Component>();
+        auto &cpool = pool<Component>();
+        // pools owned by groups are arranged according to the groups
+        assert(!cpool.owned);
+
+        for(const auto entity: static_cast<const SparseSet<Entity> &>(cpool)) {
+            unmark(entity, ctype);
+        }
+
+        from.managed<Component>() ? cpool.SparseSet<Entity, Component>::copy(from.pool<Component>()) : cpool.reset();
+
+        for(const auto entity: static_cast<const SparseSet<Entity> &>(cpool)) {
+            mark(entity, ctype);
+        }
+    }
+
+    struct Reservations final {
+        Reservations() ENTT_NOEXCEPT = default;
+
+        Reservations(Reservations &&other) ENTT_NOEXCEPT
+            : head{other.head.exchange(null)},
+              recycled{other.recycled.exchange(0u)},
+              fresh{other.fresh.exchange(0u)}
+        {}
+
+        Reservations & operator=(Reservations &&other) ENTT_NOEXCEPT {
+            head.store(other.head.exchange(null));
+            recycled.store(other.recycled.exchange(0u));
+            fresh.store(other.fresh.exchange(0u));
+            return *this;
+        }
+
+        std::size_t pending() const ENTT_NOEXCEPT {
+            return recycled.load(std::memory_order_relaxed) + fresh.load(std::memory_order_relaxed);
+        }
+
+        std::atomic<Entity> head{Entity(null)};
+        std::atomic<std::size_t> recycled{};
+        std::atomic<std::size_t> fresh{};
+    };
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = typename traits_type::entity_type;
@@ -225,6 +596,8 @@ public:
     using version_type = typename traits_type::version_type;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
+    /*! @brief Unsigned integer type used for change ticks. */
+    using tick_type = typename SparseSet<Entity>::tick_type;
     /*! @brief Unsigned integer type. */
     using tag_type = typename tag_family::family_type;
     /*! @brief Unsigned integer type. */
@@ -235,15 +608,86 @@ public:
     /*! @brief Default constructor. */
     Registry() = default;
 
+    /**
+     * @brief Constructs a registry that gets memory from the given resource.
+     *
+     * All the internal data structures of the registry, pools of components
+     * included, get their memory from the given resource.<br/>
+     * As an example, a registry backed by a monotonic resource is cheap to
+     * populate and its memory is freed at once with the resource itself.
+     *
+     * @warning
+     * The resource must outlive the registry. Otherwise, attempting to use the
+     * registry results in undefined behavior.
+     *
+     * @param resource A memory resource, if any.
+     */
+    explicit Registry(MemoryResource *resource)
+        : groups(resource), handlers(resource), pools(resource), tags(resource), cloners(resource), tcloners(resource), binders(resource), tbinders(resource), entities(resource), signatures(resource)
+    {}
+
     /*! @brief Copying a registry isn't allowed. */
     Registry(const Registry &) = delete;
-    /*! @brief Default move constructor. */
-    Registry(Registry &&) = default;
+
+    /**
+     * @brief Move constructor.
+     *
+     * Pools and tags are bound to the new registry, so that listeners receive
+     * it as an argument from now on.
+     *
+     * @param other The instance to move from.
+     */
+    Registry(Registry &&other) ENTT_NOEXCEPT
+        : groups{std::move(other.groups)},
+          handlers{std::move(other.handlers)},
+          pools{std::move(other.pools)},
+          tags{std::move(other.tags)},
+          cloners{std::move(other.cloners)},
+          tcloners{std::move(other.tcloners)},
+          binders{std::move(other.binders)},
+          tbinders{std::move(other.tbinders)},
+          entities{std::move(other.entities)},
+          signatures{std::move(other.signatures)},
+          words{std::exchange(other.words, size_type{})},
+          available{std::exchange(other.available, size_type{})},
+          next{std::exchange(other.next, entity_type{})},
+          clock{std::exchange(other.clock, tick_type{})},
+          reservations{std::move(other.reservations)}
+    {
+        rebind();
+    }
 
     /*! @brief Copying a registry isn't allowed. @return This registry. */
     Registry & operator=(const Registry &) = delete;
-    /*! @brief Default move assignment operator. @return This registry. */
-    Registry & operator=(Registry &&) = default;
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * Pools and tags are bound to this registry, so that listeners receive it
+     * as an argument from now on.
+     *
+     * @param other The instance to move from.
+     * @return This registry.
+     */
+    Registry & operator=(Registry &&other) {
+        groups = std::move(other.groups);
+        handlers = std::move(other.handlers);
+        pools = std::move(other.pools);
+        tags = std::move(other.tags);
+        cloners = std::move(other.cloners);
+        tcloners = std::move(other.tcloners);
+        binders = std::move(other.binders);
+        tbinders = std::move(other.tbinders);
+        entities = std::move(other.entities);
+        signatures = std::move(other.signatures);
+        words = std::exchange(other.words, size_type{});
+        available = std::exchange(other.available, size_type{});
+        next = std::exchange(other.next, entity_type{});
+        clock = std::exchange(other.clock, tick_type{});
+        reservations = std::move(other.reservations);
+        rebind();
+        return *this;
+    }
 
     /**
      * @brief Returns the numeric identifier of a type of tag at runtime.
@@ -305,6 +749,31 @@ public:
         return entities.size() - available;
     }
 
+    /**
+     * @brief Returns the current tick of the clock of the registry.
+     *
+     * Components for which change ticks have been requested (see change_ticks
+     * for more details) are stamped with the current tick whenever they are
+     * assigned, replaced or patched.
+     *
+     * @return The current tick of the clock of the registry.
+     */
+    tick_type tick() const ENTT_NOEXCEPT {
+        return clock;
+    }
+
+    /**
+     * @brief Advances the clock of the registry.
+     *
+     * Usually the clock is advanced once per frame. The registry never does it
+     * on its own.
+     *
+     * @return The new tick of the clock of the registry.
+     */
+    tick_type advance() ENTT_NOEXCEPT {
+        return ++clock;
+    }
+
     /**
      * @brief Increases the capacity of the pool for the given component.
      *
@@ -320,6 +789,38 @@ public:
         pool<Component>().reserve(cap);
     }
 
+    /**
+     * @brief Creates the pool for the given component, if it doesn't exist.
+     *
+     * Pools are created lazily the first time they are needed. Creating them
+     * up front ensures that getting views and accessing components later on
+     * doesn't modify the registry, as an example when it's done from multiple
+     * threads at once.
+     *
+     * @tparam Component Type of component for which to create the pool.
+     */
+    template<typename Component>
+    void assure() {
+        const auto ctype = component_family::type<Component>();
+
+        if(!(ctype < pools.size())) {
+            pools.resize(ctype + 1);
+            cloners.resize(ctype + 1);
+            binders.resize(ctype + 1);
+        }
+
+        if(signed_entities && !(ctype < words * word_size)) {
+            // signatures are laid out per entity, they must be rearranged
+            widen(ctype / word_size + 1);
+        }
+
+        if(!pools[ctype]) {
+            pools[ctype] = allocate_unique<SparseSet<Entity>, Pool<Component>>(pools.get_allocator().resource(), this, pools.get_allocator().resource());
+            cloners[ctype] = &Registry::cloning<Component>;
+            binders[ctype] = &Registry::binding<Component>;
+        }
+    }
+
     /**
      * @brief Increases the capacity of a registry in terms of entities.
      *
@@ -332,6 +833,26 @@ public:
         entities.reserve(cap);
     }
 
+    /**
+     * @brief Compacts the pool for the given component.
+     *
+     * It has no effect unless pointer-stable storage has been requested for the
+     * given component. Otherwise, components are laid out in the same order of
+     * the entities and holes left by removed components are filled in.
+     *
+     * @warning
+     * Pointers and references to components of the given type are invalidated
+     * when pointer-stable storage has been requested for them.
+     *
+     * @tparam Component Type of component to compact.
+     */
+    template<typename Component>
+    void compact() {
+        if(managed<Component>()) {
+            pool<Component>().compact();
+        }
+    }
+
     /**
      * @brief Returns the capacity of the pool for the given component.
      * @tparam Component Type of component in which one is interested.
@@ -373,7 +894,8 @@ public:
     /**
      * @brief Direct access to the list of components of a given pool.
      *
-     * The returned pointer is such that range
+     * When components are stored in a contiguous array (that is, the default),
+     * the returned pointer is such that range
      * `[raw<Component>(), raw<Component>() + size<Component>()]` is always a
      * valid range, even if the container is empty.
      *
@@ -381,6 +903,10 @@ public:
      * There are no guarantees on the order of the components. Use a view if you
      * want to iterate entities and components in the expected order.
      *
+     * @warning
+     * Empty types, types stored in chunks and types stored in columns aren't
+     * laid out in a contiguous array (see `SparseSet::raw` for more details).
+     *
      * @tparam Component Type of component in which one is interested.
      * @return A pointer to the array of components of the given type.
      */
@@ -392,7 +918,8 @@ public:
     /**
      * @brief Direct access to the list of components of a given pool.
      *
-     * The returned pointer is such that range
+     * When components are stored in a contiguous array (that is, the default),
+     * the returned pointer is such that range
      * `[raw<Component>(), raw<Component>() + size<Component>()]` is always a
      * valid range, even if the container is empty.
      *
@@ -400,6 +927,10 @@ public:
      * There are no guarantees on the order of the components. Use a view if you
      * want to iterate entities and components in the expected order.
      *
+     * @warning
+     * Empty types, types stored in chunks and types stored in columns aren't
+     * laid out in a contiguous array (see `SparseSet::raw` for more details).
+     *
      * @tparam Component Type of component in which one is interested.
      * @return A pointer to the array of components of the given type.
      */
@@ -519,6 +1050,7 @@ public:
      * @return A valid entity identifier.
      */
     entity_type create() {
+        assert(!reservations.pending());
         entity_type entity;
 
         if(available) {
@@ -538,6 +1070,94 @@ public:
         return entity;
     }
 
+    /**
+     * @brief Creates new entities and assigns them to the given range.
+     *
+     * Memory is reserved once for the whole range, so that assigning the
+     * identifiers doesn't trigger multiple reallocations. Entities are
+     * recycled if possible, otherwise newly created ones are returned, exactly
+     * as if `create` was invoked once for each element of the range.
+     *
+     * The returned entities have no components nor tags assigned.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
+     */
+    template<typename It>
+    void create(It first, It last) {
+        static_assert(std::is_convertible<entity_type, typename std::iterator_traits<It>::value_type>::value, "!");
+        const auto length = size_type(std::distance(first, last));
+        entities.reserve(entities.size() + length - std::min(length, available));
+        std::generate(first, last, [this]() { return create(); });
+    }
+
+    /**
+     * @brief Reserves an entity identifier in a thread safe manner.
+     *
+     * This function can be invoked concurrently from multiple threads, also
+     * while other threads iterate views or access components. Identifiers are
+     * recycled if possible, exactly as if `create` was invoked.<br/>
+     * Reserved identifiers aren't valid until the next call to `flush`, that
+     * is the sync point at which entities are actually created. They can be
+     * used meanwhile to record commands in a command buffer or to refer to the
+     * entities in other data structures.
+     *
+     * @warning
+     * No other function that creates or destroys entities can be invoked
+     * until the reserved identifiers are flushed. Otherwise the behavior is
+     * undefined.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * of pending reservations.
+     *
+     * @return An entity identifier that is valid from the next sync point on.
+     */
+    entity_type create(concurrent_t) {
+        auto count = reservations.recycled.load(std::memory_order_relaxed);
+
+        // the free list is popped in order, sequential creations will replay it later
+        while(count < available && !reservations.recycled.compare_exchange_weak(count, count + 1, std::memory_order_relaxed)) {}
+
+        if(count < available) {
+            entity_type entt = null;
+
+            // the first reservation captures the head of the free list
+            if(reservations.head.compare_exchange_strong(entt, next, std::memory_order_relaxed)) {
+                entt = next;
+            }
+
+            while(!reservations.head.compare_exchange_weak(entt, entities[entt] & traits_type::entity_mask, std::memory_order_relaxed)) {}
+
+            return entt | (entities[entt] & (traits_type::version_mask << traits_type::entity_shift));
+        }
+
+        const auto entity = entity_type(entities.size() + reservations.fresh.fetch_add(1u, std::memory_order_relaxed));
+        // traits_type::entity_mask is reserved to allow for null identifiers
+        assert(entity < traits_type::entity_mask);
+        return entity;
+    }
+
+    /**
+     * @brief Creates the entities reserved so far.
+     *
+     * All the identifiers returned by `create(concurrent_t)` since the last
+     * sync point become valid. The entities have no components nor tags
+     * assigned.
+     *
+     * @warning
+     * This function isn't thread safe and it must not be invoked concurrently
+     * with other functions of the registry.
+     */
+    void flush() {
+        const auto count = reservations.recycled.exchange(0u, std::memory_order_relaxed) + reservations.fresh.exchange(0u, std::memory_order_relaxed);
+        reservations.head.store(null, std::memory_order_relaxed);
+        entities.reserve(entities.size() + count - std::min(count, available));
+
+        for(size_type pos{}; pos < count; ++pos) {
+            create();
+        }
+    }
+
     /**
      * @brief Destroys the entity that owns the given tag, if any.
      *
@@ -581,33 +1201,145 @@ public:
      */
     void destroy(const entity_type entity) {
         assert(valid(entity));
+        assert(!reservations.pending());
+        const auto first = size_type(entity & traits_type::entity_mask) * words;
+
+        // only the pools the entity owns are visited, as told by its signature
+        for(auto pos = first < signatures.size() ? words : size_type{}; pos; --pos) {
+            auto mask = ~word_type{};
+
+            for(auto curr = signatures[first + pos - 1]; curr; curr = signatures[first + pos - 1] & mask) {
+                const auto bit = highest(curr);
+                pools[(pos - 1) * word_size + bit]->destroy(entity);
+                // listeners could remove other components meanwhile, the signature is read again
+                mask = (word_type{1} << bit) - 1;
+            }
+        }
 
-        for(auto pos = pools.size(); pos; --pos) {
+        for(auto pos = signed_entities ? size_type{} : pools.size(); pos; --pos) {
             auto &cpool = pools[pos-1];
 
-            if(cpool && cpool->has(entity)) {
-                cpool->destroy(entity);
+            if(cpool && cpool->has(entity)) {
+                cpool->destroy(entity);
+            }
+        }
+
+        for(auto pos = tags.size(); pos; --pos) {
+            auto &tag = tags[pos-1];
+
+            if(tag && tag->get() == entity) {
+                tag->destroy();
+            }
+        };
+
+        // just a way to protect users from listeners that attach components
+        assert(orphan(entity));
+
+        // lengthens the implicit list of destroyed entities
+        const auto entt = entity & traits_type::entity_mask;
+        const auto version = ((entity >> traits_type::entity_shift) + 1) << traits_type::entity_shift;
+        const auto node = (available ? next : ((entt + 1) & traits_type::entity_mask)) | version;
+        entities[entt] = node;
+        next = entt;
+        ++available;
+    }
+
+    /**
+     * @brief Destroys a range of entities and lets the registry recycle the
+     * identifiers.
+     *
+     * Pools are visited once each and the components are removed pool by pool,
+     * so that listeners that observe the destruction of components receive all
+     * the notifications for a type before moving to the next one. Each pool is
+     * compacted in a single pass and the owners of the tags are looked up once
+     * for the whole range. Identifiers are then recycled all at once, as if
+     * `destroy` was invoked in order for each element of the range.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used only if the iterators refer to entity identifiers.
+     *
+     * @warning
+     * In case there are listeners that observe the destruction of components
+     * and assign other components to the entities in their bodies, the result
+     * of invoking this function may not be as expected. In the worst case, it
+     * could lead to undefined behavior. An assertion will abort the execution
+     * at runtime in debug mode if a violation is detected.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to destroy an entity more than
+     * once results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    std::enable_if_t<std::is_same<std::decay_t<decltype(*std::declval<It>())>, entity_type>::value>
+    destroy(It first, It last) {
+        assert(std::all_of(first, last, [this](const auto entity) { return valid(entity); }));
+        assert(!reservations.pending());
+        container_type<word_type> owned(words, word_type{}, signatures.get_allocator());
+
+        // pools that none of the entities owns aren't visited at all
+        std::for_each(first, last, [this, &owned](const auto entity) {
+            const auto base = size_type(entity & traits_type::entity_mask) * words;
+
+            for(size_type pos = 0; pos < words && base < signatures.size(); ++pos) {
+                owned[pos] |= signatures[base + pos];
+            }
+        });
+
+        container_type<entity_type> scratch{entities.get_allocator()};
+
+        for(auto pos = pools.size(); pos; --pos) {
+            const auto ctype = pos - 1;
+
+            if(signed_entities ? (owned[ctype / word_size] & (word_type{1} << (ctype % word_size))) : bool(pools[ctype])) {
+                scratch.clear();
+
+                std::copy_if(first, last, std::back_inserter(scratch), [this, ctype](const auto entity) {
+                    return marked(entity, ctype);
+                });
+
+                // a single call per pool, that is compacted in one pass
+                pools[ctype]->destroy(scratch.data(), scratch.data() + scratch.size());
             }
-        };
+        }
 
-        for(auto pos = tags.size(); pos; --pos) {
-            auto &tag = tags[pos-1];
+        container_type<std::pair<entity_type, size_type>> attached{entities.get_allocator()};
 
-            if(tag && tag->get() == entity) {
-                tag->destroy();
+        for(auto pos = tags.size(); pos; --pos) {
+            if(tags[pos-1] && tags[pos-1]->get() != null) {
+                attached.emplace_back(tags[pos-1]->get(), pos-1);
             }
-        };
+        }
 
-        // just a way to protect users from listeners that attach components
-        assert(orphan(entity));
+        if(!attached.empty()) {
+            // owners are sorted once, then each entity is looked up in turn
+            std::sort(attached.begin(), attached.end());
 
-        // lengthens the implicit list of destroyed entities
-        const auto entt = entity & traits_type::entity_mask;
-        const auto version = ((entity >> traits_type::entity_shift) + 1) << traits_type::entity_shift;
-        const auto node = (available ? next : ((entt + 1) & traits_type::entity_mask)) | version;
-        entities[entt] = node;
-        next = entt;
-        ++available;
+            std::for_each(first, last, [this, &attached](const auto entity) {
+                auto it = std::lower_bound(attached.begin(), attached.end(), std::make_pair(entity, size_type{}));
+
+                for(; it != attached.end() && it->first == entity; ++it) {
+                    tags[it->second]->destroy();
+                }
+            });
+        }
+
+        // lengthens the implicit list of destroyed entities in a single pass
+        std::for_each(first, last, [this](const auto entity) {
+            // just a way to protect users from listeners that attach components
+            assert(valid(entity) && orphan(entity));
+            const auto entt = entity & traits_type::entity_mask;
+            const auto version = ((entity >> traits_type::entity_shift) + 1) << traits_type::entity_shift;
+            entities[entt] = (available ? next : ((entt + 1) & traits_type::entity_mask)) | version;
+            next = entt;
+            ++available;
+        });
     }
 
     /**
@@ -682,12 +1414,81 @@ public:
      * @return A reference to the newly created component.
      */
     template<typename Component, typename... Args>
-    Component & assign(const entity_type entity, Args &&... args) {
+    typename SparseSet<Entity, Component>::reference_type assign(const entity_type entity, Args &&... args) {
         assert(valid(entity));
         assure<Component>();
         return pool<Component>().construct(entity, std::forward<Args>(args)...);
     }
 
+    /**
+     * @brief Assigns the given component to a range of entities.
+     *
+     * A copy of the given instance is assigned to each entity. Memory is
+     * reserved once for the whole range and listeners that observe the
+     * construction of components are notified only when all the components
+     * have been assigned, once for each entity.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used only if the iterators refer to entity identifiers.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to assign a component to an entity
+     * that already owns it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if an entity already owns an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to create.
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the component to copy for each entity.
+     */
+    template<typename Component, typename It>
+    std::enable_if_t<std::is_same<std::decay_t<decltype(*std::declval<It>())>, entity_type>::value>
+    assign(It first, It last, const Component &value = {}) {
+        assert(std::all_of(first, last, [this](const auto entity) { return valid(entity); }));
+        assure<Component>();
+        pool<Component>().construct(first, last, value);
+    }
+
+    /**
+     * @brief Assigns each entity in a range a copy of the i-th component of
+     * another range.
+     *
+     * The i-th entity of the range is given a copy of the i-th component of the
+     * other range. In case the components are trivially copyable and
+     * contiguous (that is, `from` is a pointer), they are copied with a
+     * `memcpy`. Listeners are notified once all the components are in place.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used only if the iterators refer to entity identifiers
+     * and the other iterator refers to instances of the given component.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to assign a component to an entity
+     * that already owns it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if an entity already owns an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to create.
+     * @tparam It Type of forward iterator.
+     * @tparam Other Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of components.
+     */
+    template<typename Component, typename It, typename Other>
+    std::enable_if_t<std::is_same<std::decay_t<decltype(*std::declval<It>())>, entity_type>::value && std::is_same<std::decay_t<decltype(*std::declval<Other>())>, Component>::value>
+    assign(It first, It last, Other from) {
+        assert(std::all_of(first, last, [this](const auto entity) { return valid(entity); }));
+        assure<Component>();
+        pool<Component>().construct(first, last, from);
+    }
+
     /**
      * @brief Removes the given tag from its owner, if any.
      * @tparam Tag Type of tag to remove.
@@ -717,6 +1518,37 @@ public:
         pool<Component>().destroy(entity);
     }
 
+    /**
+     * @brief Removes the given component from a range of entities.
+     *
+     * Components are removed in a single pass over the range and listeners
+     * that observe the destruction of components are notified before any of
+     * them is actually removed, once for each entity.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used only if the iterators refer to entity identifiers.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to remove a component from an
+     * entity that doesn't own it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if an entity doesn't own an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to remove.
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename Component, typename It>
+    std::enable_if_t<std::is_same<std::decay_t<decltype(*std::declval<It>())>, entity_type>::value>
+    remove(It first, It last) {
+        assert(std::all_of(first, last, [this](const auto entity) { return valid(entity); }));
+        assert(managed<Component>());
+        pool<Component>().destroy(first, last);
+    }
+
     /**
      * @brief Checks if the given tag has an owner.
      * @tparam Tag Type of tag for which to perform the check.
@@ -762,7 +1594,7 @@ public:
         assert(valid(entity));
         bool all = true;
         using accumulator_type = bool[];
-        accumulator_type accumulator = { all, (all = all && managed<Component>() && pool<Component>().has(entity))... };
+        accumulator_type accumulator = { all, (all = all && marked(entity, component_family::type<Component>()))... };
         (void)accumulator;
         return all;
     }
@@ -817,7 +1649,7 @@ public:
      * @return A reference to the component owned by the entity.
      */
     template<typename Component>
-    const Component & get(const entity_type entity) const ENTT_NOEXCEPT {
+    typename SparseSet<Entity, Component>::const_reference_type get(const entity_type entity) const ENTT_NOEXCEPT {
         assert(valid(entity));
         assert(managed<Component>());
         return pool<Component>().get(entity);
@@ -838,8 +1670,10 @@ public:
      * @return A reference to the component owned by the entity.
      */
     template<typename Component>
-    inline Component & get(const entity_type entity) ENTT_NOEXCEPT {
-        return const_cast<Component &>(const_cast<const Registry *>(this)->get<Component>(entity));
+    inline typename SparseSet<Entity, Component>::reference_type get(const entity_type entity) ENTT_NOEXCEPT {
+        assert(valid(entity));
+        assert(managed<Component>());
+        return pool<Component>().get(entity);
     }
 
     /**
@@ -857,9 +1691,9 @@ public:
      * @return References to the components owned by the entity.
      */
     template<typename... Component>
-    inline std::enable_if_t<(sizeof...(Component) > 1), std::tuple<const Component &...>>
+    inline std::enable_if_t<(sizeof...(Component) > 1), std::tuple<typename SparseSet<Entity, Component>::const_reference_type...>>
     get(const entity_type entity) const ENTT_NOEXCEPT {
-        return std::tuple<const Component &...>{get<Component>(entity)...};
+        return std::tuple<typename SparseSet<Entity, Component>::const_reference_type...>{get<Component>(entity)...};
     }
 
     /**
@@ -877,9 +1711,9 @@ public:
      * @return References to the components owned by the entity.
      */
     template<typename... Component>
-    inline std::enable_if_t<(sizeof...(Component) > 1), std::tuple<Component &...>>
+    inline std::enable_if_t<(sizeof...(Component) > 1), std::tuple<typename SparseSet<Entity, Component>::reference_type...>>
     get(const entity_type entity) ENTT_NOEXCEPT {
-        return std::tuple<Component &...>{get<Component>(entity)...};
+        return std::tuple<typename SparseSet<Entity, Component>::reference_type...>{get<Component>(entity)...};
     }
 
     /**
@@ -910,7 +1744,11 @@ public:
      *
      * A new instance of the given component is created and initialized with the
      * arguments provided (the component must have a proper constructor or be of
-     * aggregate type). Then the component is assigned to the given entity.
+     * aggregate type). Then the component is assigned to the given entity.<br/>
+     * The instance is constructed directly in place of the old one when its
+     * construction cannot throw and all the arguments are scalars. Otherwise,
+     * a temporary object is created first, so that the arguments can safely
+     * refer to the old instance.
      *
      * @warning
      * Attempting to use an invalid entity or to replace a component of an
@@ -926,8 +1764,48 @@ public:
      * @return A reference to the newly created component.
      */
     template<typename Component, typename... Args>
-    Component & replace(const entity_type entity, Args &&... args) {
-        return (get<Component>(entity) = Component{std::forward<Args>(args)...});
+    typename SparseSet<Entity, Component>::reference_type replace(const entity_type entity, Args &&... args) {
+        assert(valid(entity));
+        assert(managed<Component>());
+        return pool<Component>().replace(entity, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Patches the given component for an entity.
+     *
+     * The function object is invoked with a reference to the component assigned
+     * to the entity, so that it can be updated in place.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(Component &);
+     * @endcode
+     *
+     * Listeners connected to the update signal are notified once the function
+     * object returns.
+     *
+     * @note
+     * Components stored in columns are built on demand. The function object
+     * receives a copy of the component that is then written back to the pool.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to patch a component of an entity
+     * that doesn't own it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if the entity doesn't own an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to patch.
+     * @tparam Func Type of the function object to invoke.
+     * @param entity A valid entity identifier.
+     * @param func A valid function object.
+     * @return A reference to the patched component.
+     */
+    template<typename Component, typename Func>
+    typename SparseSet<Entity, Component>::reference_type patch(const entity_type entity, Func func) {
+        assert(valid(entity));
+        assert(managed<Component>());
+        return pool<Component>().patch(entity, std::move(func));
     }
 
     /**
@@ -978,6 +1856,7 @@ public:
      * @endcode
      *
      * Prefer this function anyway because it has slightly better performance.
+     * Existing instances are constructed in place as described for `replace`.
      *
      * @warning
      * Attempting to use an invalid entity results in undefined behavior.<br/>
@@ -991,12 +1870,12 @@ public:
      * @return A reference to the newly created component.
      */
     template<typename Component, typename... Args>
-    Component & accommodate(const entity_type entity, Args &&... args) {
+    typename SparseSet<Entity, Component>::reference_type accommodate(const entity_type entity, Args &&... args) {
         assure<Component>();
         auto &cpool = pool<Component>();
 
         return cpool.has(entity)
-                ? cpool.get(entity) = Component{std::forward<Args>(args)...}
+                ? cpool.replace(entity, std::forward<Args>(args)...)
                 : cpool.construct(entity, std::forward<Args>(args)...);
     }
 
@@ -1116,6 +1995,37 @@ public:
         return pool<Component>().destruction();
     }
 
+    /**
+     * @brief Returns a sink object for the given component.
+     *
+     * A sink is an opaque object used to connect listeners to components.<br/>
+     * The sink returned by this function can be used to receive notifications
+     * whenever an instance of the given component is replaced or patched, either
+     * by means of `replace`, `accommodate` or `patch`.
+     *
+     * The function type for a listener is:
+     * @code{.cpp}
+     * void(Registry<Entity> &, Entity);
+     * @endcode
+     *
+     * Listeners are invoked **after** the component has been replaced. The
+     * order of invocation of the listeners isn't guaranteed.<br/>
+     * Note also that the greater the number of listeners, the greater the
+     * performance hit when a component is replaced.
+     *
+     * @sa SigH::Sink
+     *
+     * @tparam Component Type of component of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<typename Component>
+    sink_type update() ENTT_NOEXCEPT {
+        // see silent_update, the signal isn't published for these types
+        static_assert(!silent_update<Component>::value, "!");
+        assure<Component>();
+        return pool<Component>().update();
+    }
+
     /**
      * @brief Sorts the pool of entities for the given component.
      *
@@ -1149,6 +2059,11 @@ public:
      * necessarily the type of the one passed along with the other parameters to
      * this member function.
      *
+     * @warning
+     * Pools owned by a group can't be sorted.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * pool of the given component is owned by a group.
+     *
      * @tparam Component Type of components to sort.
      * @tparam Compare Type of comparison function object.
      * @tparam Sort Type of sort function object.
@@ -1160,6 +2075,7 @@ public:
     template<typename Component, typename Compare, typename Sort = StdSort, typename... Args>
     void sort(Compare compare, Sort sort = Sort{}, Args &&... args) {
         assure<Component>();
+        assert(!pool<Component>().owned);
         pool<Component>().sort(std::move(compare), std::move(sort), std::forward<Args>(args)...);
     }
 
@@ -1190,6 +2106,11 @@ public:
      *
      * Any subsequent change to `B` won't affect the order in `A`.
      *
+     * @warning
+     * Pools owned by a group can't be sorted.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * pool of the components to sort is owned by a group.
+     *
      * @tparam To Type of components to sort.
      * @tparam From Type of components to use to sort.
      */
@@ -1197,6 +2118,7 @@ public:
     void sort() {
         assure<To>();
         assure<From>();
+        assert(!pool<To>().owned);
         pool<To>().respect(pool<From>());
     }
 
@@ -1308,9 +2230,14 @@ public:
      */
     bool orphan(const entity_type entity) const {
         assert(valid(entity));
+        const auto first = size_type(entity & traits_type::entity_mask) * words;
         bool orphan = true;
 
-        for(std::size_t i = 0; i < pools.size() && orphan; ++i) {
+        for(std::size_t i = 0; i < words && first < signatures.size() && orphan; ++i) {
+            orphan = !signatures[first + i];
+        }
+
+        for(std::size_t i = 0; !signed_entities && i < pools.size() && orphan; ++i) {
             const auto &cpool = pools[i];
             orphan = !(cpool && cpool->has(entity));
         }
@@ -1387,6 +2314,39 @@ public:
         return View<Entity, Component...>{(assure<Component>(), pool<Component>())...};
     }
 
+    /**
+     * @brief Returns a standard view for the given components that filters out
+     * the entities that have any of the excluded components.
+     *
+     * This kind of views are created on the fly and share with the registry its
+     * internal data structures.<br/>
+     * Excluded components are tested along with the other components while
+     * iterating and thus the filter doesn't require additional lookups to the
+     * registry. As an example:
+     *
+     * @code{.cpp}
+     * registry.view<Position, Brain>(entt::exclude<Stunned>).each([](auto entity, auto &position, auto &brain) {
+     *     // ...
+     * });
+     * @endcode
+     *
+     * @note
+     * Only multi component views support exclusion lists. Use a runtime view to
+     * filter out entities from a single set of components.
+     *
+     * @see View
+     *
+     * @tparam Component Type of components used to construct the view.
+     * @tparam Exclude Types of components used to filter the view.
+     * @return A newly created standard view.
+     */
+    template<typename... Component, typename... Exclude>
+    View<Entity, Component...> view(exclude_t<Exclude...>) {
+        static_assert(sizeof...(Component) > 1, "!");
+        std::vector<const SparseSet<Entity> *> filter{(assure<Exclude>(), &pool<Exclude>())...};
+        return View<Entity, Component...>{std::move(filter), (assure<Component>(), pool<Component>())...};
+    }
+
     /**
      * @brief Prepares the internal data structures used by persistent views.
      *
@@ -1399,26 +2359,30 @@ public:
      * requested.<br/>
      * To avoid costly operations, internal data structures for persistent views
      * can be prepared with this function. Just use the same set of components
-     * that would have been used otherwise to construct the view.
+     * (and the same exclusion list, if any) that would have been used otherwise
+     * to construct the view.
      *
      * @tparam Component Types of components used to prepare the view.
+     * @tparam Exclude Types of components used to filter the view.
      */
-    template<typename... Component>
-    void prepare() {
+    template<typename... Component, typename... Exclude>
+    void prepare(exclude_t<Exclude...> = {}) {
         static_assert(sizeof...(Component) > 1, "!");
-        const auto htype = handler_family::type<Component...>();
+        const auto htype = handler_family::type<exclude_t<Exclude...>, Component...>();
 
         if(!(htype < handlers.size())) {
             handlers.resize(htype + 1);
         }
 
         if(!handlers[htype]) {
-            connect<Component...>(std::make_index_sequence<sizeof...(Component)>{});
-            handlers[htype] = std::make_unique<SparseSet<entity_type>>();
+            connect<Component...>(exclude_t<Exclude...>{}, std::make_index_sequence<sizeof...(Component)>{});
+            handlers[htype] = allocate_unique<SparseSet<Entity>>(handlers.get_allocator().resource(), handlers.get_allocator().resource());
             auto &handler = *handlers[htype];
 
             for(auto entity: view<Component...>()) {
-                handler.construct(entity);
+                if(!excluded(exclude_t<Exclude...>{}, entity)) {
+                    handler.construct(entity);
+                }
             }
         }
     }
@@ -1437,24 +2401,26 @@ public:
      * neither in debug mode nor in release mode.
      *
      * @tparam Component Types of components of the persistent view.
+     * @tparam Exclude Types of components used to filter the view.
      */
-    template<typename... Component>
-    void discard() {
-        if(contains<Component...>()) {
-            disconnect<Component...>(std::make_index_sequence<sizeof...(Component)>{});
-            handlers[handler_family::type<Component...>()].reset();
+    template<typename... Component, typename... Exclude>
+    void discard(exclude_t<Exclude...> = {}) {
+        if(contains<Component...>(exclude_t<Exclude...>{})) {
+            disconnect<Component...>(exclude_t<Exclude...>{}, std::make_index_sequence<sizeof...(Component)>{});
+            handlers[handler_family::type<exclude_t<Exclude...>, Component...>()].reset();
         }
     }
 
     /**
      * @brief Checks if a persistent view has already been prepared.
      * @tparam Component Types of components of the persistent view.
+     * @tparam Exclude Types of components used to filter the view.
      * @return True if the view has already been prepared, false otherwise.
      */
-    template<typename... Component>
-    bool contains() const ENTT_NOEXCEPT {
+    template<typename... Component, typename... Exclude>
+    bool contains(exclude_t<Exclude...> = {}) const ENTT_NOEXCEPT {
         static_assert(sizeof...(Component) > 1, "!");
-        const auto htype = handler_family::type<Component...>();
+        const auto htype = handler_family::type<exclude_t<Exclude...>, Component...>();
         return (htype < handlers.size() && handlers[htype]);
     }
 
@@ -1482,6 +2448,15 @@ public:
      * That being said, persistent views are an incredibly powerful tool if used
      * with care and offer a boost of performance undoubtedly.
      *
+     * An exclusion list can be provided to filter out the entities that have
+     * any of the given components. In this case, the registry keeps the set of
+     * entities of the view exact by listening also to the construction and
+     * destruction of the excluded components:
+     *
+     * @code{.cpp}
+     * auto view = registry.view<Position, Brain>(entt::persistent_t{}, entt::exclude<Stunned>);
+     * @endcode
+     *
      * @note
      * Consider to use the `prepare` member function to initialize the internal
      * data structures used by persistent views when the registry is still
@@ -1495,12 +2470,13 @@ public:
      * @see RuntimeView
      *
      * @tparam Component Types of components used to construct the view.
+     * @tparam Exclude Types of components used to filter the view.
      * @return A newly created persistent view.
      */
-    template<typename... Component>
-    PersistentView<Entity, Component...> view(persistent_t) {
-        prepare<Component...>();
-        const auto htype = handler_family::type<Component...>();
+    template<typename... Component, typename... Exclude>
+    PersistentView<Entity, Component...> view(persistent_t, exclude_t<Exclude...> = {}) {
+        prepare<Component...>(exclude_t<Exclude...>{});
+        const auto htype = handler_family::type<exclude_t<Exclude...>, Component...>();
         return PersistentView<Entity, Component...>{*handlers[htype], (assure<Component>(), pool<Component>())...};
     }
 
@@ -1568,7 +2544,119 @@ public:
             return ctype < pools.size() ? pools[ctype].get() : nullptr;
         });
 
-        return RuntimeView<Entity>{std::move(set)};
+        return RuntimeView<Entity>{std::move(set), {}};
+    }
+
+    /**
+     * @brief Returns a runtime view for the given components that filters out
+     * the entities that have any of the excluded components.
+     *
+     * This kind of views are created on the fly and share with the registry its
+     * internal data structures.<br/>
+     * Excluded components are tested along with the other components while
+     * iterating and thus the filter doesn't require additional lookups to the
+     * registry.
+     *
+     * @see RuntimeView
+     *
+     * @tparam It Type of forward iterator.
+     * @tparam Exclude Type of forward iterator for the excluded components.
+     * @param first An iterator to the first element of the range of components.
+     * @param last An iterator past the last element of the range of components.
+     * @param xfirst An iterator to the first element of the range of components
+     * to exclude.
+     * @param xlast An iterator past the last element of the range of components
+     * to exclude.
+     * @return A newly created runtime view.
+     */
+    template<typename It, typename Exclude>
+    RuntimeView<Entity> view(It first, It last, Exclude xfirst, Exclude xlast) {
+        static_assert(std::is_convertible<typename std::iterator_traits<It>::value_type, component_type>::value, "!");
+        static_assert(std::is_convertible<typename std::iterator_traits<Exclude>::value_type, component_type>::value, "!");
+        std::vector<const SparseSet<Entity> *> set(std::distance(first, last));
+        std::vector<const SparseSet<Entity> *> filter(std::distance(xfirst, xlast));
+
+        const auto candidate = [this](const component_type ctype) {
+            return ctype < pools.size() ? pools[ctype].get() : nullptr;
+        };
+
+        std::transform(first, last, set.begin(), candidate);
+        std::transform(xfirst, xlast, filter.begin(), candidate);
+
+        return RuntimeView<Entity>{std::move(set), std::move(filter)};
+    }
+
+    /**
+     * @brief Returns an owning group for the given components.
+     *
+     * This kind of objects are created on the fly and share with the registry
+     * its internal data structures.<br/>
+     * Feel free to discard a group after the use. Creating and destroying a
+     * group is an incredibly cheap operation, but for the first time it's
+     * requested. In this case, the registry arranges the pools of the given
+     * components so that all the entities that have them are packed at the
+     * front of each pool and in the same order.<br/>
+     * From then on, the registry keeps the pools arranged by means of the
+     * construction and destruction signals of the components.
+     *
+     * Groups are the fastest tool to iterate entities and components, no
+     * lookup is required to find the components of an entity.<br/>
+     * However they have also drawbacks:
+     *
+     * * A group owns the pools of its components. Thus a component can be part
+     *   of a single group and the pools owned by a group can't be sorted.
+     * * Internal data structures used to construct groups must be kept updated
+     *   and it affects slightly construction and destruction of components.
+     *
+     * @warning
+     * Components are swapped within their pools when entities join or leave a
+     * group. Iterators, pointers and references to components of the given
+     * types are therefore invalidated more often than usual.<br/>
+     * Attempting to create a group for a component that is already owned by
+     * another group results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if a
+     * component is already owned by a different group.
+     *
+     * @see Group
+     *
+     * @tparam Component Types of components owned by the group.
+     * @return A newly created owning group.
+     */
+    template<typename... Component>
+    Group<Entity, Component...> group() {
+        static_assert(sizeof...(Component) > 1, "!");
+        const auto gtype = group_family::type<Component...>();
+
+        if(!(gtype < groups.size())) {
+            groups.resize(gtype + 1);
+        }
+
+        if(!groups[gtype]) {
+            using accumulator_type = int[];
+            accumulator_type owners = { (assure<Component>(), assert(!pool<Component>().owned), pool<Component>().owned = true, 0)... };
+            (void)owners;
+
+            groups[gtype] = allocate_unique<Grouping>(groups.get_allocator().resource());
+            auto &cpool = pool<std::tuple_element_t<0, std::tuple<Component...>>>();
+            auto &length = groups[gtype]->length;
+
+            // entities already sorted out are never visited twice
+            for(size_type pos{}, last = cpool.size(); pos < last; ++pos) {
+                const auto entity = cpool.data()[pos];
+
+                if(has<Component...>(entity)) {
+                    arrange<Component...>(entity, length++);
+                }
+            }
+
+            accumulator_type listeners = { (
+                pool<Component>().hctor.sink().template connect<&Registry::grouping<Component...>>(),
+                pool<Component>().hdtor.sink().template connect<&Registry::ungrouping<Component...>>(),
+            0)... };
+            (void)listeners;
+        }
+
+        return Group<Entity, Component...>{groups[gtype]->length, pool<Component>()...};
     }
 
     /**
@@ -1637,13 +2725,185 @@ public:
         return { (*this = {}), assure };
     }
 
+    /**
+     * @brief Makes a deep copy of a registry into another registry.
+     *
+     * The other registry becomes an exact copy of this one. Identifiers,
+     * versions and the list of entities to recycle are copied along with the
+     * components, the tags, the change ticks and the internal data structures
+     * of groups and persistent views, so that entities, components and
+     * iteration orders are the same in both the registries.<br/>
+     * The only exception is the clock, that never goes backwards. The clock of
+     * the other registry is set to the one of this registry only if it's
+     * behind, so that the ticks that users took from it stay meaningful.<br/>
+     * Pools of trivially copyable components are copied with a `memcpy` and
+     * the memory already used by the other registry is reused whenever
+     * possible. Therefore, cloning a registry repeatedly into the same registry
+     * is the way to go to take snapshots for rollbacks or speculative
+     * simulations.
+     *
+     * Example of use:
+     *
+     * @code{.cpp}
+     * entt::DefaultRegistry branch;
+     * registry.clone(branch);
+     * // simulate ahead on the branch, then roll back
+     * branch.clone(registry);
+     * @endcode
+     *
+     * @note
+     * Listeners aren't copied. Those connected to the other registry stay
+     * connected to it, so that objects bound to a registry (as an example,
+     * observers) aren't shared with its branches. The internal handlers of
+     * groups and persistent views are copied instead.
+     *
+     * @warning
+     * All the types of components must be copyable. Pools of components that
+     * aren't copyable can be cloned only if empty.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * a non-copyable component has been assigned to an entity, the two
+     * registries are the same or any of them has pending reservations.
+     *
+     * @param other The registry to which to copy this registry.
+     */
+    void clone(Registry &other) const {
+        assert(this != &other);
+        assert(!reservations.pending() && !other.reservations.pending());
+
+        for(auto pos = std::max(cloners.size(), other.cloners.size()); pos; --pos) {
+            const auto ctype = pos - 1;
+            // pools that exist only in the other registry are cleared
+            auto *func = (ctype < cloners.size() && cloners[ctype]) ? cloners[ctype] : (ctype < other.cloners.size() ? other.cloners[ctype] : nullptr);
+
+            if(func) {
+                func(*this, other);
+            }
+        }
+
+        for(auto pos = std::max(tcloners.size(), other.tcloners.size()); pos; --pos) {
+            const auto ttype = pos - 1;
+            auto *func = (ttype < tcloners.size() && tcloners[ttype]) ? tcloners[ttype] : (ttype < other.tcloners.size() ? other.tcloners[ttype] : nullptr);
+
+            if(func) {
+                func(tag_t{}, *this, other);
+            }
+        }
+
+        other.handlers.resize(std::max(handlers.size(), other.handlers.size()));
+
+        for(size_type pos{}, last = other.handlers.size(); pos < last; ++pos) {
+            if(pos < handlers.size() && handlers[pos]) {
+                if(!other.handlers[pos]) {
+                    other.handlers[pos] = allocate_unique<SparseSet<Entity>>(other.handlers.get_allocator().resource(), other.handlers.get_allocator().resource());
+                }
+
+                other.handlers[pos]->copy(*handlers[pos]);
+            } else {
+                other.handlers[pos].reset();
+            }
+        }
+
+        other.groups.resize(std::max(groups.size(), other.groups.size()));
+
+        for(size_type pos{}, last = other.groups.size(); pos < last; ++pos) {
+            if(pos < groups.size() && groups[pos]) {
+                if(!other.groups[pos]) {
+                    other.groups[pos] = allocate_unique<Grouping>(other.groups.get_allocator().resource());
+                }
+
+                *other.groups[pos] = *groups[pos];
+            } else {
+                other.groups[pos].reset();
+            }
+        }
+
+        const auto length = other.words;
+        internal::replicate(other.entities, entities);
+        internal::replicate(other.signatures, signatures);
+        other.words = words;
+        other.available = available;
+        other.next = next;
+        // the clock never goes backwards, ticks taken from it stay meaningful
+        other.clock = std::max(other.clock, clock);
+
+        if(words < length) {
+            // the other registry knows more types of components than this one
+            other.widen(length);
+        }
+    }
+
+    /**
+     * @brief Copies the given components and the entities of a registry into
+     * another registry.
+     *
+     * Identifiers, versions and the list of entities to recycle of the other
+     * registry are overwritten with those of this registry, while its clock is
+     * only ever moved forward. Pools of the given components are overwritten
+     * as well, as if they were cloned (see `clone` for more details). All the
+     * other components, the tags and the listeners of the other registry are
+     * left untouched.<br/>
+     * This function is meant to save and restore the state of a subset of the
+     * pools of a registry, as an example to roll back a simulation:
+     *
+     * @code{.cpp}
+     * registry.clone<Position, Velocity>(state);
+     * // ...
+     * state.clone<Position, Velocity>(registry);
+     * @endcode
+     *
+     * @note
+     * Listeners aren't invoked. Persistent views that involve the given
+     * components aren't updated and go stale: they keep returning the entities
+     * they contained before the copy, including those that have been destroyed
+     * by it, and miss those that have come back to life. Discard them and
+     * create them again after the copy.
+     *
+     * @warning
+     * Components other than the given ones that are assigned to entities that
+     * either are destroyed or come back to life because of the copy aren't
+     * touched. It's up to the caller to copy all the components that live and
+     * die with entities created and destroyed in the meantime.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the two registries are the same, any of them has pending reservations or
+     * the pools of the given components are owned by a group in the other
+     * registry.
+     *
+     * @tparam Component Types of components to copy.
+     * @param other The registry to which to copy the given components.
+     */
+    template<typename... Component>
+    void clone(Registry &other) const {
+        static_assert(sizeof...(Component) > 0, "!");
+        assert(this != &other);
+        assert(!reservations.pending() && !other.reservations.pending());
+
+        internal::replicate(other.entities, entities);
+        other.available = available;
+        other.next = next;
+        // the clock never goes backwards, ticks taken from it stay meaningful
+        other.clock = std::max(other.clock, clock);
+
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (other.copy<Component>(*this), 0)... };
+        (void)accumulator;
+    }
+
 private:
-    std::vector<std::unique_ptr<SparseSet<Entity>>> handlers;
-    std::vector<std::unique_ptr<SparseSet<Entity>>> pools;
-    std::vector<std::unique_ptr<Attachee<Entity>>> tags;
-    std::vector<entity_type> entities;
+    container_type<owner_type<Grouping>> groups;
+    container_type<owner_type<SparseSet<Entity>>> handlers;
+    container_type<owner_type<SparseSet<Entity>>> pools;
+    container_type<owner_type<Attachee<Entity>>> tags;
+    container_type<clone_fn_type *> cloners;
+    container_type<clone_tag_fn_type *> tcloners;
+    container_type<bind_fn_type *> binders;
+    container_type<bind_tag_fn_type *> tbinders;
+    container_type<entity_type> entities;
+    container_type<word_type> signatures;
+    size_type words{};
     size_type available{};
     entity_type next{};
+    tick_type clock{};
+    Reservations reservations{};
 };
 
 
@@ -0,0 +1,202 @@
+#ifndef ENTT_ENTITY_ROLLBACK_HPP
+#define ENTT_ENTITY_ROLLBACK_HPP
+
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include "../config/config.h"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Rollback buffer.
+ *
+ * A rollback buffer is a ring of states of a registry, one per tick. Each state
+ * contains the entities of the registry and the pools of the given components,
+ * nothing more. States are saved at the end of a tick and restored when the
+ * ticks that follow must be simulated again, as an example after a
+ * misprediction in a networked game:
+ *
+ * @code{.cpp}
+ * entt::RollbackBuffer<entt::DefaultRegistry::entity_type, Position, Velocity> rollback{8u};
+ *
+ * // at the end of each tick
+ * rollback.save(registry, tick);
+ *
+ * // when the inputs received for a past tick differ from the predicted ones
+ * rollback.restore(registry, tick - 3);
+ * @endcode
+ *
+ * States are stored in registries that are allocated once and for all when the
+ * buffer is constructed. Saving and restoring a state are plain copies of the
+ * entities and of the pools (see `Registry::clone` for more details). Pools of
+ * trivially copyable components are copied with a `memcpy` and the memory
+ * used by the states is reused from a tick to the next one. Therefore, once
+ * the buffer has been warmed up (see `reserve`), neither saving nor restoring
+ * a state allocate memory.
+ *
+ * @warning
+ * Components other than the given ones aren't saved. In case entities are
+ * created or destroyed between two ticks, all the components that can be
+ * assigned to them should be part of the state.<br/>
+ * Pools of the given components can't be owned by groups. Persistent views
+ * that involve them aren't updated when a state is restored and they go stale,
+ * they must be created again after a restore.<br/>
+ * The clock of the registry is never moved backwards by a restore, so that
+ * change ticks and delta snapshots keep working across rollbacks.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Component Types of components to save.
+ */
+template<typename Entity, typename... Component>
+class RollbackBuffer final {
+    static_assert(sizeof...(Component) > 0, "!");
+
+    struct Slot final {
+        Registry<Entity> state;
+        typename Registry<Entity>::tick_type tick{};
+        bool valid{};
+    };
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = Registry<Entity>;
+    /*! @brief Unsigned integer type used for ticks. */
+    using tick_type = typename registry_type::tick_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a rollback buffer for the given number of ticks.
+     * @param capacity Number of states that the buffer can contain.
+     */
+    explicit RollbackBuffer(const size_type capacity)
+        : slots(capacity)
+    {
+        assert(capacity);
+    }
+
+    /**
+     * @brief Constructs a rollback buffer that gets memory from the given
+     * resource.
+     * @param capacity Number of states that the buffer can contain.
+     * @param resource A memory resource, if any.
+     */
+    RollbackBuffer(const size_type capacity, MemoryResource *resource)
+        : slots{}
+    {
+        assert(capacity);
+        slots.reserve(capacity);
+
+        for(auto pos = capacity; pos; --pos) {
+            slots.push_back(Slot{registry_type{resource}, {}, {}});
+        }
+    }
+
+    /*! @brief Copying a rollback buffer isn't allowed. */
+    RollbackBuffer(const RollbackBuffer &) = delete;
+    /*! @brief Default move constructor. */
+    RollbackBuffer(RollbackBuffer &&) = default;
+
+    /*! @brief Copying a rollback buffer isn't allowed. @return This buffer. */
+    RollbackBuffer & operator=(const RollbackBuffer &) = delete;
+    /*! @brief Default move assignment operator. @return This buffer. */
+    RollbackBuffer & operator=(RollbackBuffer &&) = default;
+
+    /**
+     * @brief Number of states that a rollback buffer can contain.
+     * @return Capacity of the rollback buffer.
+     */
+    size_type capacity() const ENTT_NOEXCEPT {
+        return slots.size();
+    }
+
+    /**
+     * @brief Increases the capacity of all the states of a rollback buffer.
+     *
+     * Memory for the given number of entities is allocated in advance, both
+     * for the entities and for the pools of the components of all the states.
+     *
+     * @param cap Desired capacity of the states.
+     */
+    void reserve(const size_type cap) {
+        for(auto &&slot: slots) {
+            slot.state.reserve(cap);
+
+            using accumulator_type = int[];
+            accumulator_type accumulator = { (slot.state.template reserve<Component>(cap), 0)... };
+            (void)accumulator;
+        }
+    }
+
+    /**
+     * @brief Checks if a rollback buffer contains the state of a given tick.
+     * @param tick A tick.
+     * @return True if the state of the tick can be restored, false otherwise.
+     */
+    bool contains(const tick_type tick) const ENTT_NOEXCEPT {
+        const auto &slot = slots[tick % slots.size()];
+        return slot.valid && slot.tick == tick;
+    }
+
+    /**
+     * @brief Saves the state of a registry for a given tick.
+     *
+     * The state takes the place of the one saved `capacity()` ticks before,
+     * if any.
+     *
+     * @param registry A valid reference to a registry.
+     * @param tick The tick to which the state refers.
+     */
+    void save(const registry_type &registry, const tick_type tick) {
+        auto &slot = slots[tick % slots.size()];
+        registry.template clone<Component...>(slot.state);
+        slot.tick = tick;
+        slot.valid = true;
+    }
+
+    /**
+     * @brief Restores the state of a registry for a given tick.
+     *
+     * The states of the ticks that follow the given one are discarded, they
+     * belong to a timeline that doesn't exist anymore.
+     *
+     * @param registry A valid reference to a registry.
+     * @param tick The tick to which the state to restore refers.
+     * @return True if the state has been restored, false if the buffer doesn't
+     * contain the state of the given tick.
+     */
+    bool restore(registry_type &registry, const tick_type tick) {
+        if(!contains(tick)) {
+            return false;
+        }
+
+        slots[tick % slots.size()].state.template clone<Component...>(registry);
+
+        for(auto &&slot: slots) {
+            slot.valid = slot.valid && !(tick < slot.tick);
+        }
+
+        return true;
+    }
+
+    /*! @brief Discards all the states. */
+    void clear() ENTT_NOEXCEPT {
+        for(auto &&slot: slots) {
+            slot.valid = false;
+        }
+    }
+
+private:
+    std::vector<Slot> slots;
+};
+
+
+}
+
+
+#endif // ENTT_ENTITY_ROLLBACK_HPP
@@ -2,21 +2,54 @@
 #define ENTT_ENTITY_SNAPSHOT_HPP
 
 
-#include <array>
+#include <vector>
 #include <cstddef>
 #include <utility>
 #include <cassert>
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
 #include <unordered_map>
 #include "../config/config.h"
 #include "entt_traits.hpp"
+#include "sparse_set.hpp"
 #include "utility.hpp"
 
 
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Type>
+using is_contiguous = std::integral_constant<bool, !stable_storage<Type>::value && !column_storage<Type>::value>;
+
+
+template<typename Type>
+using is_bulk_serializable = std::integral_constant<
+    bool,
+    std::is_trivially_copyable<Type>::value
+        && std::is_default_constructible<Type>::value
+        && is_contiguous<Type>::value
+>;
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
 /**
  * @brief Forward declaration of the registry class.
  */
@@ -47,34 +80,69 @@ class Snapshot final {
           follow{follow}
     {}
 
-    template<typename Component, typename Archive, typename It>
-    void get(Archive &archive, std::size_t sz, It first, It last) const {
+    template<typename Component, typename Archive>
+    void get(Archive &archive, std::true_type) const {
+        const auto sz = registry.template size<Component>();
+        const auto *entities = registry.template data<Component>();
+        const auto *instances = registry.template raw<Component>();
+
         archive(static_cast<Entity>(sz));
 
-        while(first != last) {
-            const auto entity = *(first++);
+        // entities and instances are visited in lockstep, no lookups required
+        for(std::remove_const_t<decltype(sz)> i{}; i < sz; ++i) {
+            archive(entities[i], instances[std::is_empty<Component>::value ? 0 : i]);
+        }
+    }
 
-            if(registry.template has<Component>(entity)) {
-                archive(entity, registry.template get<Component>(entity));
-            }
+    template<typename Component, typename Archive>
+    void get(Archive &archive, std::false_type) const {
+        const auto sz = registry.template size<Component>();
+        const auto *entities = registry.template data<Component>();
+
+        archive(static_cast<Entity>(sz));
+
+        for(std::remove_const_t<decltype(sz)> i{}; i < sz; ++i) {
+            const auto entity = entities[i];
+            archive(entity, registry.template get<Component>(entity));
         }
     }
 
-    template<typename... Component, typename Archive, typename It, std::size_t... Indexes>
-    void component(Archive &archive, It first, It last, std::index_sequence<Indexes...>) const {
-        std::array<std::size_t, sizeof...(Indexes)> size{};
-        auto begin = first;
+    template<typename Component, typename Archive, typename It>
+    void get(Archive &archive, std::vector<Entity> &buffer, It first, It last) const {
+        buffer.clear();
+
+        // entities are tested only once and only if the pool isn't empty
+        if(registry.template size<Component>()) {
+            std::copy_if(first, last, std::back_inserter(buffer), [this](const auto entity) {
+                return registry.template has<Component>(entity);
+            });
+        }
+
+        archive(static_cast<Entity>(buffer.size()));
 
-        while(begin != last) {
-            const auto entity = *(begin++);
-            using accumulator_type = std::size_t[];
-            accumulator_type accumulator = { (registry.template has<Component>(entity) ? ++size[Indexes] : size[Indexes])... };
-            (void)accumulator;
+        for(const auto entity: buffer) {
+            archive(entity, registry.template get<Component>(entity));
         }
+    }
 
-        using accumulator_type = int[];
-        accumulator_type accumulator = { (get<Component>(archive, size[Indexes], first, last), 0)... };
-        (void)accumulator;
+    template<typename Component, typename Archive>
+    void bulk(Archive &archive, std::true_type) const {
+        const auto sz = registry.template size<Component>();
+        archive(static_cast<Entity>(sz));
+
+        if(sz) {
+            // entities and instances are put aside as contiguous blocks
+            archive(registry.template data<Component>(), sz);
+
+            if(!std::is_empty<Component>::value) {
+                archive(registry.template raw<Component>(), sz);
+            }
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void bulk(Archive &archive, std::false_type) const {
+        component<Component>(archive);
     }
 
 public:
@@ -146,16 +214,7 @@ public:
      */
     template<typename Component, typename Archive>
     const Snapshot & component(Archive &archive) const {
-        const auto sz = registry.template size<Component>();
-        const auto *entities = registry.template data<Component>();
-
-        archive(static_cast<Entity>(sz));
-
-        for(std::remove_const_t<decltype(sz)> i{}; i < sz; ++i) {
-            const auto entity = entities[i];
-            archive(entity, registry.template get<Component>(entity));
-        };
-
+        get<Component>(archive, internal::is_contiguous<Component>{});
         return *this;
     }
 
@@ -179,6 +238,43 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Puts aside the given components as contiguous blocks.
+     *
+     * For each component, the size of the pool is followed by the array of
+     * entities and by the array of instances as returned by `data` and `raw`.
+     * Therefore, the output archive must also offer a function call operator
+     * that accepts a pointer to the first element of an array and its length,
+     * so that it can put aside the whole array at once:
+     *
+     * @code{.cpp}
+     * template<typename Type>
+     * void operator()(const Type *first, std::size_t length);
+     * @endcode
+     *
+     * This is possible only for trivially copyable and default constructible
+     * components that are stored as plain arrays (see `stable_storage` and
+     * `column_storage` for more details). Instances of empty types aren't
+     * serialized at all. Any other component is put aside one instance at a
+     * time, as if the non-bulk version of this function was used.
+     *
+     * @warning
+     * The snapshot must be restored with the bulk version of
+     * `SnapshotLoader::component`, the two formats aren't compatible.
+     *
+     * @tparam Component Types of components to serialize.
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Component, typename Archive>
+    const Snapshot & component(raw_t, Archive &archive) const {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (bulk<Component>(archive, internal::is_bulk_serializable<Component>{}), 0)... };
+        (void)accumulator;
+        return *this;
+    }
+
     /**
      * @brief Puts aside the given components for the entities in a range.
      *
@@ -195,7 +291,10 @@ public:
      */
     template<typename... Component, typename Archive, typename It>
     const Snapshot & component(Archive &archive, It first, It last) const {
-        component<Component...>(archive, first, last, std::make_index_sequence<sizeof...(Component)>{});
+        std::vector<Entity> buffer;
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (get<Component>(archive, buffer, first, last), 0)... };
+        (void)accumulator;
         return *this;
     }
 
@@ -303,6 +402,37 @@ class SnapshotLoader final {
         }
     }
 
+    template<typename Component, typename Archive>
+    void bulk(Archive &archive, std::true_type) const {
+        Entity length{};
+        archive(length);
+
+        if(length) {
+            const auto sz = static_cast<std::size_t>(length);
+            std::vector<Entity> entities(sz);
+            archive(entities.data(), sz);
+
+            for(const auto entity: entities) {
+                static constexpr auto destroyed = false;
+                assure_fn(registry, entity, destroyed);
+            }
+
+            if(std::is_empty<Component>::value) {
+                registry.template assign<Component>(entities.cbegin(), entities.cend());
+            } else {
+                std::vector<Component> instances(sz);
+                archive(instances.data(), sz);
+                // instances go through a temporary buffer, then into the pool all at once
+                registry.template assign<Component>(entities.cbegin(), entities.cend(), instances.data());
+            }
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void bulk(Archive &archive, std::false_type) const {
+        assign<Component>(archive);
+    }
+
 public:
     /*! @brief Copying a snapshot loader isn't allowed. */
     SnapshotLoader(const SnapshotLoader &) = delete;
@@ -369,6 +499,40 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Restores components put aside as contiguous blocks and assigns
+     * them to the right entities.
+     *
+     * The template parameter list must be exactly the same used during
+     * serialization. The input archive must also offer a function call operator
+     * that accepts a pointer to the first element of an array and its length,
+     * so that it can restore the whole array at once:
+     *
+     * @code{.cpp}
+     * template<typename Type>
+     * void operator()(Type *first, std::size_t length);
+     * @endcode
+     *
+     * Entities that don't exist yet are created with the versions they
+     * originally had. Pools are then filled in a single pass. Instances of
+     * trivially copyable components are read into a temporary array first and
+     * then copied to the pools with a `memcpy`, that is, they are copied twice.
+     *
+     * @sa Snapshot::component
+     *
+     * @tparam Component Types of components to restore.
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename... Component, typename Archive>
+    const SnapshotLoader & component(raw_t, Archive &archive) const {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (bulk<Component>(archive, internal::is_bulk_serializable<Component>{}), 0)... };
+        (void)accumulator;
+        return *this;
+    }
+
     /**
      * @brief Restores tags and assigns them to the right entities.
      *
@@ -491,6 +655,36 @@ class ContinuousLoader final {
         }
     }
 
+    void discard(Entity entity) {
+        const auto it = remloc.find(entity);
+
+        if(it != remloc.cend()) {
+            const auto local = it->second.first;
+
+            if(registry.valid(local)) {
+                registry.destroy(local);
+            }
+
+            remloc.erase(it);
+        }
+    }
+
+    template<typename Component, typename Archive>
+    void remove(Archive &archive) {
+        Entity length{};
+        archive(length);
+
+        while(length--) {
+            Entity entity{};
+            archive(entity);
+            const auto it = remloc.find(entity);
+
+            if(it != remloc.cend() && registry.valid(it->second.first)) {
+                registry.template reset<Component>(it->second.first);
+            }
+        }
+    }
+
     template<typename Component>
     void reset() {
         for(auto &&ref: remloc) {
@@ -607,6 +801,48 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Applies a delta snapshot.
+     *
+     * The template parameter list must be exactly the same used during
+     * serialization (see DeltaSnapshot for more details). Local counterparts of
+     * the entities destroyed in the meantime are destroyed and forgotten,
+     * components removed from the remote entities are removed from their
+     * local counterparts and all the other components are either assigned or
+     * replaced. In the event that the entity to which a component is assigned
+     * doesn't exist yet, the loader will take care to create a local
+     * counterpart for it.<br/>
+     * Members can be either data members of type entity_type or containers of
+     * entities. In both cases, the loader will visit them and update the
+     * entities by replacing each one with its local counterpart.
+     *
+     * @warning
+     * Unlike full snapshots, deltas don't list all the entities in use. Do not
+     * invoke `shrink` after applying a delta, unless you know exactly what you
+     * are doing, or entities that didn't change will be purged.
+     *
+     * @tparam Component Types of components to restore.
+     * @tparam Archive Type of input archive.
+     * @tparam Type Types of components to update with local counterparts.
+     * @tparam Member Types of members to update with their local counterparts.
+     * @param archive A valid reference to an input archive.
+     * @param member Members to update with their local counterparts.
+     * @return A non-const reference to this loader.
+     */
+    template<typename... Component, typename Archive, typename... Type, typename... Member>
+    ContinuousLoader & delta(Archive &archive, Member Type:: *... member) {
+        auto apply = [this](const auto entity, const auto &component) {
+            registry.template accommodate<std::decay_t<decltype(component)>>(entity, component);
+        };
+
+        assure(archive, &ContinuousLoader::discard);
+
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (remove<Component>(archive), assign<Component>(archive, apply, member...), 0)... };
+        (void)accumulator;
+        return *this;
+    }
+
     /**
      * @brief Restores tags and assigns them to the right entities.
      *
@@ -7,11 +7,15 @@
 #include <numeric>
 #include <utility>
 #include <vector>
+#include <tuple>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <cassert>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/algorithm.hpp"
+#include "../core/memory.hpp"
 #include "entt_traits.hpp"
 #include "entity.hpp"
 
@@ -29,6 +33,76 @@ template<typename...>
 class SparseSet;
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Type, typename Alloc>
+void replicate(std::vector<Type, Alloc> &to, const std::vector<Type, Alloc> &from, std::true_type) {
+    // trivially copyable objects are copied all at once, storage is reused
+    to.resize(from.size());
+
+    if(!from.empty()) {
+        std::memcpy(to.data(), from.data(), from.size() * sizeof(Type));
+    }
+}
+
+
+template<typename Type, typename Alloc>
+void replicate(std::vector<Type, Alloc> &to, const std::vector<Type, Alloc> &from, std::false_type) {
+    to.clear();
+    to.insert(to.end(), from.cbegin(), from.cend());
+}
+
+
+template<typename Type, typename Alloc>
+void replicate(std::vector<Type, Alloc> &to, const std::vector<Type, Alloc> &from) {
+    replicate(to, from, std::integral_constant<bool, std::is_trivially_copyable<Type>::value && std::is_default_constructible<Type>::value>{});
+}
+
+
+template<typename Type, typename Alloc>
+void extend(std::vector<Type, Alloc> &to, const Type *from, const std::size_t length, std::true_type) {
+    // contiguous trivially copyable objects are copied all at once
+    const auto size = to.size();
+    to.resize(size + length);
+
+    if(length) {
+        std::memcpy(to.data() + size, from, length * sizeof(Type));
+    }
+}
+
+
+template<typename Type, typename Alloc, typename It>
+void extend(std::vector<Type, Alloc> &to, It from, const std::size_t length, std::false_type) {
+    to.reserve(to.size() + length);
+
+    for(auto pos = length; pos; --pos) {
+        to.push_back(*(from++));
+    }
+}
+
+
+template<typename Type, typename Alloc, typename It>
+void extend(std::vector<Type, Alloc> &to, It from, const std::size_t length) {
+    extend(to, from, length, std::integral_constant<bool, std::is_pointer<It>::value && std::is_trivially_copyable<Type>::value && std::is_default_constructible<Type>::value>{});
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
 /**
  * @brief Basic sparse set implementation.
  *
@@ -44,6 +118,11 @@ class SparseSet;
  * web. This is nothing more than a customized implementation suitable for the
  * purpose of the framework.
  *
+ * The sparse array is split in pages of fixed size (see `ENTT_PAGE_SIZE`) that
+ * are allocated lazily. Therefore the memory required by a sparse set grows
+ * with the number of pages actually in use rather than with the greatest
+ * identifier it has ever contained.
+ *
  * @note
  * There are no guarantees that entities are returned in the insertion order
  * when iterate a sparse set. Do not make assumption on the order in any case.
@@ -60,10 +139,16 @@ template<typename Entity>
 class SparseSet<Entity> {
     using traits_type = entt_traits<Entity>;
 
+    static constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(Entity);
+    static_assert(entt_per_page && !(entt_per_page & (entt_per_page - 1)), "!");
+
+    using page_type = std::vector<Entity, Allocator<Entity>>;
+    using packed_type = std::vector<Entity, Allocator<Entity>>;
+
     class Iterator final {
         friend class SparseSet<Entity>;
 
-        using direct_type = const std::vector<Entity>;
+        using direct_type = const packed_type;
         using index_type = typename traits_type::difference_type;
 
         Iterator(direct_type *direct, index_type index) ENTT_NOEXCEPT
@@ -164,11 +249,35 @@ class SparseSet<Entity> {
         index_type index;
     };
 
+    inline auto page(const Entity entity) const ENTT_NOEXCEPT {
+        return std::size_t{(entity & traits_type::entity_mask) / entt_per_page};
+    }
+
+    inline auto offset(const Entity entity) const ENTT_NOEXCEPT {
+        return std::size_t{entity & (entt_per_page - 1)};
+    }
+
+    Entity * assure(const std::size_t pos) {
+        if(!(pos < reverse.size())) {
+            // pages share the allocator of the sparse array
+            reverse.resize(pos+1, page_type{reverse.get_allocator()});
+        }
+
+        if(reverse[pos].empty()) {
+            // null is safe in all cases for our purposes
+            reverse[pos].assign(entt_per_page, null);
+        }
+
+        return reverse[pos].data();
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
+    /*! @brief Unsigned integer type used for change ticks. */
+    using tick_type = std::uint64_t;
     /*! @brief Input iterator type. */
     using iterator_type = Iterator;
     /*! @brief Constant input iterator type. */
@@ -177,6 +286,14 @@ public:
     /*! @brief Default constructor. */
     SparseSet() ENTT_NOEXCEPT = default;
 
+    /**
+     * @brief Constructs a sparse set that gets memory from the given resource.
+     * @param resource A memory resource, if any.
+     */
+    explicit SparseSet(MemoryResource *resource) ENTT_NOEXCEPT
+        : reverse(resource), direct(resource)
+    {}
+
     /*! @brief Default destructor. */
     virtual ~SparseSet() ENTT_NOEXCEPT = default;
 
@@ -219,10 +336,15 @@ public:
      * Usually the size of the internal sparse array is equal or greater than
      * the one of the internal packed array.
      *
+     * @note
+     * The sparse array is paginated and the extent is always a multiple of the
+     * number of elements per page. Pages within the extent aren't necessarily
+     * allocated.
+     *
      * @return Extent of the sparse set.
      */
     size_type extent() const ENTT_NOEXCEPT {
-        return reverse.size();
+        return reverse.size() * entt_per_page;
     }
 
     /**
@@ -381,9 +503,9 @@ public:
      * @return True if the sparse set contains the entity, false otherwise.
      */
     bool has(const entity_type entity) const ENTT_NOEXCEPT {
-        const auto pos = size_type(entity & traits_type::entity_mask);
+        const auto curr = page(entity);
         // testing against null permits to avoid accessing the direct vector
-        return (pos < reverse.size()) && (reverse[pos] != null);
+        return (curr < reverse.size()) && !reverse[curr].empty() && (reverse[curr][offset(entity)] != null);
     }
 
     /**
@@ -404,10 +526,10 @@ public:
      * @return True if the sparse set contains the entity, false otherwise.
      */
     bool fast(const entity_type entity) const ENTT_NOEXCEPT {
-        const auto pos = size_type(entity & traits_type::entity_mask);
-        assert(pos < reverse.size());
+        const auto curr = page(entity);
+        assert(curr < reverse.size());
         // testing against null permits to avoid accessing the direct vector
-        return (reverse[pos] != null);
+        return !reverse[curr].empty() && (reverse[curr][offset(entity)] != null);
     }
 
     /**
@@ -424,8 +546,7 @@ public:
      */
     size_type get(const entity_type entity) const ENTT_NOEXCEPT {
         assert(has(entity));
-        const auto pos = size_type(entity & traits_type::entity_mask);
-        return size_type(reverse[pos]);
+        return size_type(reverse[page(entity)][offset(entity)]);
     }
 
     /**
@@ -441,15 +562,37 @@ public:
      */
     void construct(const entity_type entity) {
         assert(!has(entity));
-        const auto pos = size_type(entity & traits_type::entity_mask);
+        assure(page(entity))[offset(entity)] = entity_type(direct.size());
+        direct.push_back(entity);
+    }
 
-        if(!(pos < reverse.size())) {
-            // null is safe in all cases for our purposes
-            reverse.resize(pos+1, null);
+    /**
+     * @brief Assigns a range of entities to a sparse set.
+     *
+     * Memory is reserved once for the whole range, then entities are added to
+     * the sparse set in a single pass. It's faster than assigning entities one
+     * at a time.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the sparse set
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set already contains one of the given entities.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void construct(It first, It last) {
+        direct.reserve(direct.size() + std::distance(first, last));
+
+        for(; first != last; ++first) {
+            const entity_type entity = *first;
+            assert(!has(entity));
+            assure(page(entity))[offset(entity)] = entity_type(direct.size());
+            direct.push_back(entity);
         }
-
-        reverse[pos] = entity_type(direct.size());
-        direct.push_back(entity);
     }
 
     /**
@@ -466,14 +609,64 @@ public:
     virtual void destroy(const entity_type entity) {
         assert(has(entity));
         const auto back = direct.back();
-        auto &candidate = reverse[size_type(entity & traits_type::entity_mask)];
+        auto &candidate = reverse[page(entity)][offset(entity)];
         // swapping isn't required here, we are getting rid of the last element
-        reverse[back & traits_type::entity_mask] = candidate;
+        reverse[page(back)][offset(back)] = candidate;
         direct[size_type(candidate)] = back;
         candidate = null;
         direct.pop_back();
     }
 
+    /**
+     * @brief Removes a range of entities from a sparse set.
+     *
+     * Entities are first marked, then the holes they leave in the packed array
+     * are filled with the surviving entities found at its end. Each element is
+     * moved at most once and no calls are dispatched through the virtual
+     * table.
+     *
+     * @warning
+     * Attempting to remove an entity that doesn't belong to the sparse set or
+     * to remove the same entity more than once results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set doesn't contain one of the given entities.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * Pointers to entity identifiers are accepted by the type erased version
+     * of this function instead, so that derived classes aren't bypassed.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    std::enable_if_t<!std::is_convertible<It, const entity_type *>::value>
+    destroy(It first, It last) {
+        compact(first, last, [](auto...) {});
+    }
+
+    /**
+     * @brief Removes a contiguous range of entities from a sparse set.
+     *
+     * Type erased version of the function above, it allows to remove a range
+     * of entities with a single call through the virtual table.
+     *
+     * @warning
+     * Attempting to remove an entity that doesn't belong to the sparse set or
+     * to remove the same entity more than once results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set doesn't contain one of the given entities.
+     *
+     * @param first A pointer to the first element of the range of entities.
+     * @param last A pointer past the last element of the range of entities.
+     */
+    virtual void destroy(const entity_type *first, const entity_type *last) {
+        compact(first, last, [](auto...) {});
+    }
+
     /**
      * @brief Swaps the position of two entities in the internal packed array.
      *
@@ -494,7 +687,7 @@ public:
         assert(rhs < direct.size());
         auto &src = direct[lhs];
         auto &dst = direct[rhs];
-        std::swap(reverse[src & traits_type::entity_mask], reverse[dst & traits_type::entity_mask]);
+        std::swap(reverse[page(src)][offset(src)], reverse[page(dst)][offset(dst)]);
         std::swap(src, dst);
     }
 
@@ -536,6 +729,26 @@ public:
         }
     }
 
+    /**
+     * @brief Copies the content of another sparse set.
+     *
+     * After the copy, a sparse set contains the same entities of the other
+     * sparse set and in the same order. Both the sparse array and the packed
+     * array are copied with a `memcpy` and the memory already in use is reused
+     * whenever possible.
+     *
+     * @param other The sparse set to copy.
+     */
+    void copy(const SparseSet &other) {
+        reverse.resize(other.reverse.size(), page_type{reverse.get_allocator()});
+
+        for(size_type pos{}, last = other.reverse.size(); pos < last; ++pos) {
+            internal::replicate(reverse[pos], other.reverse[pos]);
+        }
+
+        internal::replicate(direct, other.direct);
+    }
+
     /**
      * @brief Resets a sparse set.
      */
@@ -544,165 +757,956 @@ public:
         direct.clear();
     }
 
+protected:
+    /**
+     * @brief Removes a range of entities and fills the holes from the back.
+     *
+     * The function object is invoked every time an entity is moved from the
+     * back of the packed array to a hole. Its signature must be equivalent to
+     * the following:
+     *
+     * @code{.cpp}
+     * void(const size_type from, const size_type to);
+     * @endcode
+     *
+     * @tparam It Type of forward iterator.
+     * @tparam Func Type of the function object to invoke.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param func A valid function object.
+     * @return The number of entities that are still in the sparse set.
+     */
+    template<typename It, typename Func>
+    size_type compact(It first, It last, Func func) {
+        auto length = direct.size();
+
+        // holes are marked with null, that is never a valid identifier
+        for(auto it = first; it != last; ++it) {
+            assert(has(*it) && direct[get(*it)] != null);
+            direct[get(*it)] = null;
+            --length;
+        }
+
+        for(auto tail = direct.size(); first != last; ++first) {
+            auto &candidate = reverse[page(*first)][offset(*first)];
+            const auto pos = size_type(candidate);
+            candidate = null;
+
+            if(pos < length) {
+                // surviving entities past the new end fill the holes in order
+                while(direct[--tail] == null);
+                const auto back = direct[tail];
+                reverse[page(back)][offset(back)] = entity_type(pos);
+                direct[pos] = back;
+                func(tail, pos);
+            }
+        }
+
+        direct.erase(direct.begin() + length, direct.end());
+        return length;
+    }
+
 private:
-    std::vector<entity_type> reverse;
-    std::vector<entity_type> direct;
+    std::vector<page_type, Allocator<page_type>> reverse;
+    packed_type direct;
 };
 
 
 /**
- * @brief Extended sparse set implementation.
+ * @brief Storage policy for the objects of a sparse set.
  *
- * This specialization of a sparse set associates an object to an entity. The
- * main purpose of this class is to use sparse sets to store components in a
- * Registry. It guarantees fast access both to the elements and to the entities.
+ * By default, objects are stored in a contiguous array that is reallocated
+ * when it grows and removing an object moves the last one in the hole. Specialize
+ * this class and make it inherit from `std::true_type` to store the objects of a
+ * given type in chunks of memory instead. In this case:
  *
- * @note
- * Entities and objects have the same order. It's guaranteed both in case of raw
- * access (either to entities or objects) and when using input iterators.
+ * * Objects never move once constructed, pointers and references to them remain
+ *   valid until they are removed. Types that are neither copyable nor movable
+ *   are accepted as well, as long as they have a constructor. They cannot be
+ *   compacted though.
+ * * Holes left by removed objects are reused by the next ones.
+ * * Objects are laid out in the same order of the entities only after a call to
+ *   `compact`, that is the only function that moves them and the only one that
+ *   requires them to be movable.
+ * * Objects are always reached through an array of indexes to their slots.
+ *   Neither iterations nor `raw` walk the chunks as contiguous blocks, this is
+ *   left to the default storage.
  *
- * @note
- * Internal data structures arrange elements to maximize performance. Because of
- * that, there are no guarantees that elements have the expected order when
- * iterate directly the internal packed array (see `raw` and `size` member
- * functions for that). Use `begin` and `end` instead.
+ * As an example:
  *
- * @sa SparseSet<Entity>
+ * @code{.cpp}
+ * namespace entt {
+ *     template<>
+ *     struct stable_storage<Heavy>: std::true_type {};
+ * }
+ * @endcode
  *
- * @tparam Entity A valid entity type (see entt_traits for more details).
  * @tparam Type Type of objects assigned to the entities.
  */
-template<typename Entity, typename Type>
-class SparseSet<Entity, Type>: public SparseSet<Entity> {
-    using underlying_type = SparseSet<Entity>;
-    using traits_type = entt_traits<Entity>;
+template<typename Type>
+struct stable_storage: std::false_type {};
 
-    template<bool Const>
-    class Iterator final {
-        friend class SparseSet<Entity, Type>;
 
-        using instance_type = std::conditional_t<Const, const std::vector<Type>, std::vector<Type>>;
-        using index_type = typename traits_type::difference_type;
+/**
+ * @brief Column storage policy for the objects of a sparse set.
+ *
+ * By default, objects are stored in an array of structures. Specialize this
+ * class, make it inherit from `std::true_type` and give it a static member
+ * function `members` that returns a tuple of pointers to all the data members
+ * of a type to store its objects as a structure of arrays instead. Each data
+ * member has its own contiguous array (namely a _column_), so that loops that
+ * touch only a few data members stream through memory and are easily
+ * vectorized by the compiler. In this case:
+ *
+ * * Objects don't exist as such in memory. Accessing an object returns a const
+ *   copy of it built out of the columns, so that attempts to modify it don't
+ *   compile. Changes must go either through `replace` or directly through the
+ *   columns (see `column` for more details).
+ * * Types must be default constructible and copy assignable. All the data
+ *   members must be listed and data members of type `bool` aren't supported.
+ *   A compilation error is raised if the listed data members don't fill the
+ *   type up to its trailing padding. Data members small enough to fit in the
+ *   padding can't be detected though.
+ * * Columns are in sync with each other and with the array of entities.
+ *
+ * As an example:
+ *
+ * @code{.cpp}
+ * namespace entt {
+ *     template<>
+ *     struct column_storage<Position>: std::true_type {
+ *         static constexpr auto members() {
+ *             return std::make_tuple(&Position::x, &Position::y, &Position::z);
+ *         }
+ *     };
+ * }
+ * @endcode
+ *
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Type>
+struct column_storage: std::false_type {};
 
-        Iterator(instance_type *instances, index_type index) ENTT_NOEXCEPT
-            : instances{instances}, index{index}
-        {}
 
-    public:
-        using difference_type = index_type;
-        using value_type = std::conditional_t<Const, const Type, Type>;
-        using pointer = value_type *;
-        using reference = value_type &;
-        using iterator_category = std::random_access_iterator_tag;
+/**
+ * @brief Enables change ticks for a type of objects.
+ *
+ * By default, sparse sets don't keep track of changes to their objects. When
+ * this class is specialized for a type, the sparse sets for that type keep
+ * also an array of ticks laid out the same way the entities are. Ticks follow
+ * their entities when the sparse sets are sorted or elements are swapped.<br/>
+ * Ticks are stamped by users (see `SparseSet::stamp`). The registry stamps
+ * components with its own clock whenever they are assigned, replaced or
+ * patched, so that systems can visit only what changed since a given tick.
+ *
+ * As an example:
+ *
+ * @code{.cpp}
+ * namespace entt {
+ *     template<>
+ *     struct change_ticks<Position>: std::true_type {};
+ * }
+ * @endcode
+ *
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Type>
+struct change_ticks: std::false_type {};
 
-        Iterator() ENTT_NOEXCEPT = default;
 
-        Iterator(const Iterator &) ENTT_NOEXCEPT = default;
-        Iterator & operator=(const Iterator &) ENTT_NOEXCEPT = default;
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
 
-        Iterator & operator++() ENTT_NOEXCEPT {
-            return --index, *this;
-        }
 
-        Iterator operator++(int) ENTT_NOEXCEPT {
-            Iterator orig = *this;
-            return ++(*this), orig;
-        }
+namespace internal {
 
-        Iterator & operator--() ENTT_NOEXCEPT {
-            return ++index, *this;
-        }
 
-        Iterator operator--(int) ENTT_NOEXCEPT {
-            Iterator orig = *this;
-            return --(*this), orig;
-        }
+template<typename Type>
+class ChunkedStorage {
+    static constexpr auto per_chunk = (ENTT_PAGE_SIZE / sizeof(Type)) ? (ENTT_PAGE_SIZE / sizeof(Type)) : std::size_t{1};
 
-        Iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
-            index -= value;
-            return *this;
-        }
+    using element_type = std::aligned_storage_t<sizeof(Type), alignof(Type)>;
+    using allocator_type = Allocator<element_type>;
 
-        Iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
-            return Iterator{instances, index-value};
-        }
+    Type * element(const std::size_t slot) const ENTT_NOEXCEPT {
+        return reinterpret_cast<Type *>(chunks[slot / per_chunk] + slot % per_chunk);
+    }
 
-        inline Iterator & operator-=(const difference_type value) ENTT_NOEXCEPT {
-            return (*this += -value);
+    template<typename Container>
+    static void prepare(Container &container, const std::size_t length) {
+        if(container.capacity() < length) {
+            container.reserve(std::max(length, container.capacity() * 2));
         }
+    }
 
-        inline Iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
-            return (*this + -value);
-        }
+    std::size_t next() {
+        // reserves in advance so that neither push_back can fail later
+        prepare(slots, slots.size() + 1);
+        prepare(available, slots.size() + available.size() + 1);
 
-        difference_type operator-(const Iterator &other) const ENTT_NOEXCEPT {
-            return other.index - index;
+        if(available.empty() && !(slots.size() < chunks.size() * per_chunk)) {
+            chunks.push_back(allocator.allocate(per_chunk));
         }
 
-        reference operator[](const difference_type value) const ENTT_NOEXCEPT {
-            const auto pos = size_type(index-value-1);
-            return (*instances)[pos];
-        }
+        // when there are no holes, all the slots in use are taken
+        return available.empty() ? slots.size() : available.back();
+    }
 
-        bool operator==(const Iterator &other) const ENTT_NOEXCEPT {
-            return other.index == index;
-        }
+    template<typename... Args>
+    std::enable_if_t<std::is_constructible<Type, Args...>::value>
+    build(const std::size_t slot, Args &&... args) {
+        new (element(slot)) Type(std::forward<Args>(args)...);
+    }
 
-        inline bool operator!=(const Iterator &other) const ENTT_NOEXCEPT {
-            return !(*this == other);
-        }
+    template<typename... Args>
+    std::enable_if_t<!std::is_constructible<Type, Args...>::value>
+    build(const std::size_t slot, Args &&... args) {
+        new (element(slot)) Type{std::forward<Args>(args)...};
+    }
 
-        bool operator<(const Iterator &other) const ENTT_NOEXCEPT {
-            return index > other.index;
-        }
+    void release() ENTT_NOEXCEPT {
+        clear();
 
-        bool operator>(const Iterator &other) const ENTT_NOEXCEPT {
-            return index < other.index;
+        for(auto *chunk: chunks) {
+            allocator.deallocate(chunk, per_chunk);
         }
 
-        inline bool operator<=(const Iterator &other) const ENTT_NOEXCEPT {
-            return !(*this > other);
-        }
+        chunks.clear();
+    }
 
-        inline bool operator>=(const Iterator &other) const ENTT_NOEXCEPT {
-            return !(*this < other);
-        }
+public:
+    using size_type = std::size_t;
 
-        pointer operator->() const ENTT_NOEXCEPT {
-            const auto pos = size_type(index-1);
-            return &(*instances)[pos];
-        }
+    ChunkedStorage() ENTT_NOEXCEPT = default;
 
-        inline reference operator*() const ENTT_NOEXCEPT {
-            return *operator->();
-        }
+    ChunkedStorage(MemoryResource *resource) ENTT_NOEXCEPT
+        : allocator{resource}, chunks(resource), slots(resource), available(resource)
+    {}
 
-    private:
-        instance_type *instances;
-        index_type index;
-    };
+    ~ChunkedStorage() ENTT_NOEXCEPT {
+        release();
+    }
 
-public:
-    /*! @brief Type of the objects associated to the entities. */
-    using object_type = Type;
-    /*! @brief Underlying entity identifier. */
-    using entity_type = typename underlying_type::entity_type;
-    /*! @brief Unsigned integer type. */
-    using size_type = typename underlying_type::size_type;
-    /*! @brief Input iterator type. */
-    using iterator_type = Iterator<false>;
-    /*! @brief Constant input iterator type. */
-    using const_iterator_type = Iterator<true>;
+    ChunkedStorage(const ChunkedStorage &) = delete;
 
-    /*! @brief Default constructor. */
-    SparseSet() ENTT_NOEXCEPT = default;
+    ChunkedStorage(ChunkedStorage &&other) ENTT_NOEXCEPT
+        : allocator{other.allocator}, chunks{std::move(other.chunks)}, slots{std::move(other.slots)}, available{std::move(other.available)}
+    {
+        other.chunks.clear();
+        other.slots.clear();
+        other.available.clear();
+    }
 
-    /*! @brief Copying a sparse set isn't allowed. */
-    SparseSet(const SparseSet &) = delete;
-    /*! @brief Default move constructor. */
-    SparseSet(SparseSet &&) = default;
+    ChunkedStorage & operator=(const ChunkedStorage &) = delete;
+
+    ChunkedStorage & operator=(ChunkedStorage &&other) ENTT_NOEXCEPT {
+        if(this != &other) {
+            release();
+            allocator = other.allocator;
+            chunks = std::move(other.chunks);
+            slots = std::move(other.slots);
+            available = std::move(other.available);
+            other.chunks.clear();
+            other.slots.clear();
+            other.available.clear();
+        }
 
-    /*! @brief Copying a sparse set isn't allowed. @return This sparse set. */
+        return *this;
+    }
+
+    size_type size() const ENTT_NOEXCEPT {
+        return slots.size();
+    }
+
+    void reserve(const size_type cap) {
+        slots.reserve(cap);
+
+        while(chunks.size() * per_chunk < cap) {
+            chunks.push_back(allocator.allocate(per_chunk));
+        }
+    }
+
+    Type * data() const ENTT_NOEXCEPT {
+        return chunks.empty() ? nullptr : element(0);
+    }
+
+    Type & operator[](const size_type pos) const ENTT_NOEXCEPT {
+        return *element(slots[pos]);
+    }
+
+    Type & back() const ENTT_NOEXCEPT {
+        return *element(slots.back());
+    }
+
+    template<typename... Args>
+    void emplace_back(Args &&... args) {
+        const auto slot = next();
+        build(slot, std::forward<Args>(args)...);
+
+        if(!available.empty()) {
+            available.pop_back();
+        }
+
+        slots.push_back(slot);
+    }
+
+    void erase(const size_type pos) ENTT_NOEXCEPT {
+        // objects don't move, only the indexes of their slots are swapped
+        std::swap(slots[pos], slots.back());
+        element(slots.back())->~Type();
+        available.push_back(slots.back());
+        slots.pop_back();
+    }
+
+    void swap(const size_type lhs, const size_type rhs) ENTT_NOEXCEPT {
+        std::swap(slots[lhs], slots[rhs]);
+    }
+
+    void clear() ENTT_NOEXCEPT {
+        for(const auto slot: slots) {
+            element(slot)->~Type();
+        }
+
+        slots.clear();
+        available.clear();
+    }
+
+    void copy(const ChunkedStorage &other) {
+        // copies are compact, holes of the other storage aren't preserved
+        clear();
+        reserve(other.size());
+
+        for(size_type pos{}, last = other.size(); pos < last; ++pos) {
+            emplace_back(other[pos]);
+        }
+    }
+
+    void compact() {
+        static_assert(std::is_move_constructible<Type>::value && std::is_move_assignable<Type>::value, "!");
+        const auto none = ~size_type{};
+        std::vector<size_type> owner(slots.size() + available.size(), none);
+
+        for(size_type pos = 0; pos < slots.size(); ++pos) {
+            owner[slots[pos]] = pos;
+        }
+
+        for(size_type pos = 0; pos < slots.size(); ++pos) {
+            const auto curr = slots[pos];
+
+            if(curr != pos) {
+                if(owner[pos] == none) {
+                    new (element(pos)) Type(std::move(*element(curr)));
+                    element(curr)->~Type();
+                    owner[curr] = none;
+                } else {
+                    using std::swap;
+                    swap(*element(pos), *element(curr));
+                    slots[owner[pos]] = curr;
+                    owner[curr] = owner[pos];
+                }
+
+                slots[pos] = pos;
+                owner[pos] = pos;
+            }
+        }
+
+        available.clear();
+    }
+
+private:
+    allocator_type allocator;
+    std::vector<element_type *, Allocator<element_type *>> chunks;
+    std::vector<size_type, Allocator<size_type>> slots;
+    std::vector<size_type, Allocator<size_type>> available;
+};
+
+
+template<typename Type, bool = column_storage<Type>::value>
+struct column_sequence {
+    // never used, column storage isn't defined for types that don't ask for it
+    using type = void;
+};
+
+
+template<typename Type>
+struct column_sequence<Type, true> {
+    static constexpr auto size = std::tuple_size<decltype(column_storage<Type>::members())>::value;
+    static_assert(size, "!");
+    using type = std::make_index_sequence<size>;
+};
+
+
+template<typename Type, typename Field>
+constexpr std::size_t column_bytes(Field Type:: *) ENTT_NOEXCEPT {
+    return sizeof(Field);
+}
+
+
+template<typename Type, typename... Member>
+constexpr std::size_t column_bytes(std::tuple<Member...>) ENTT_NOEXCEPT {
+    std::size_t bytes{};
+    using accumulator_type = std::size_t[];
+    accumulator_type accumulator = { 0u, (bytes += column_bytes<Type>(Member{}))... };
+    return (void)accumulator, bytes;
+}
+
+
+template<typename Type, typename = typename column_sequence<Type>::type>
+class ColumnStorage;
+
+
+template<typename Type, std::size_t... Index>
+class ColumnStorage<Type, std::index_sequence<Index...>> {
+    template<typename Field>
+    static Field field(Field Type:: *);
+
+    template<std::size_t Member>
+    using field_type = decltype(field(std::get<Member>(column_storage<Type>::members())));
+
+    template<std::size_t Member>
+    using column_type = std::vector<field_type<Member>, Allocator<field_type<Member>>>;
+
+    // data members that aren't listed would be silently dropped otherwise
+    static_assert((column_bytes<Type>(decltype(column_storage<Type>::members()){}) + alignof(Type) - 1) / alignof(Type) * alignof(Type) == sizeof(Type), "!");
+
+    template<std::size_t Member>
+    static constexpr auto member() ENTT_NOEXCEPT {
+        static_assert(!std::is_same<field_type<Member>, bool>::value, "!");
+        return std::get<Member>(column_storage<Type>::members());
+    }
+
+    template<typename Field, typename Column>
+    static bool match(Field Type:: *lhs, Field Type:: *rhs, const Column &column, const Field *&ptr) ENTT_NOEXCEPT {
+        return lhs == rhs ? (ptr = column.data(), true) : false;
+    }
+
+    template<typename Field, typename Other, typename Column>
+    static bool match(Field Type:: *, Other Type:: *, const Column &, const Field *&) ENTT_NOEXCEPT {
+        return false;
+    }
+
+    template<typename Column>
+    static void pop(Column &column, const std::size_t pos) {
+        // see SparseSet<Entity, Type>::pop for the reasons of the temporary
+        auto tmp = std::move(column.back());
+        column[pos] = std::move(tmp);
+        column.pop_back();
+    }
+
+    void prepare(const std::size_t length) {
+        // all the columns grow together so that none of them can fail after
+        // the others have already accepted a new element
+        const auto cap = std::get<0>(columns).capacity();
+
+        if(cap < length) {
+            reserve(std::max(length, cap * 2));
+        }
+    }
+
+public:
+    using size_type = std::size_t;
+
+    ColumnStorage() ENTT_NOEXCEPT = default;
+
+    ColumnStorage(MemoryResource *resource) ENTT_NOEXCEPT
+        : columns{column_type<Index>(resource)...}
+    {}
+
+    size_type size() const ENTT_NOEXCEPT {
+        return std::get<0>(columns).size();
+    }
+
+    void reserve(const size_type cap) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (std::get<Index>(columns).reserve(cap), 0)... };
+        (void)accumulator;
+    }
+
+    Type operator[](const size_type pos) const {
+        Type value{};
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (value.*member<Index>() = std::get<Index>(columns)[pos], 0)... };
+        (void)accumulator;
+        return value;
+    }
+
+    Type back() const {
+        return (*this)[size() - 1];
+    }
+
+    template<typename... Args>
+    void emplace_back(Args &&... args) {
+        const Type value(std::forward<Args>(args)...);
+        prepare(size() + 1);
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (std::get<Index>(columns).push_back(value.*member<Index>()), 0)... };
+        (void)accumulator;
+    }
+
+    void insert(const size_type length, const Type &value) {
+        prepare(size() + length);
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (std::get<Index>(columns).insert(std::get<Index>(columns).end(), length, value.*member<Index>()), 0)... };
+        (void)accumulator;
+    }
+
+    void assign(const size_type pos, const Type &value) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (std::get<Index>(columns)[pos] = value.*member<Index>(), 0)... };
+        (void)accumulator;
+    }
+
+    void erase(const size_type pos) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (pop(std::get<Index>(columns), pos), 0)... };
+        (void)accumulator;
+    }
+
+    void swap(const size_type lhs, const size_type rhs) {
+        using std::swap;
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (swap(std::get<Index>(columns)[lhs], std::get<Index>(columns)[rhs]), 0)... };
+        (void)accumulator;
+    }
+
+    void clear() ENTT_NOEXCEPT {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (std::get<Index>(columns).clear(), 0)... };
+        (void)accumulator;
+    }
+
+    void copy(const ColumnStorage &other) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (replicate(std::get<Index>(columns), std::get<Index>(other.columns)), 0)... };
+        (void)accumulator;
+    }
+
+    template<typename Field>
+    const Field * column(Field Type:: *data) const ENTT_NOEXCEPT {
+        const Field *ptr = nullptr;
+        bool found = false;
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (found = match(data, member<Index>(), std::get<Index>(columns), ptr) || found, 0)... };
+        (void)accumulator;
+        assert(found);
+        return ptr;
+    }
+
+private:
+    std::tuple<column_type<Index>...> columns;
+};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Extended sparse set implementation.
+ *
+ * This specialization of a sparse set associates an object to an entity. The
+ * main purpose of this class is to use sparse sets to store components in a
+ * Registry. It guarantees fast access both to the elements and to the entities.
+ *
+ * @note
+ * Entities and objects have the same order. It's guaranteed both in case of raw
+ * access (either to entities or objects) and when using input iterators.
+ *
+ * @note
+ * Internal data structures arrange elements to maximize performance. Because of
+ * that, there are no guarantees that elements have the expected order when
+ * iterate directly the internal packed array (see `raw` and `size` member
+ * functions for that). Use `begin` and `end` instead.
+ *
+ * @note
+ * Empty types aren't stored at all. Entities are kept in the underlying sparse
+ * set as usual but all of them share the same instance of the given type, that
+ * is what is returned when accessing the objects. This instance is also shared
+ * by all the sparse sets for the given type, even across registries. Objects
+ * are still constructed from the arguments provided, then they are discarded.
+ *
+ * @note
+ * Objects are stored in a contiguous array by default. Pointer-stable storage
+ * is available on demand for types that are large or cannot be moved (see
+ * stable_storage for more details). Types can also be stored as a structure of
+ * arrays, one per data member (see column_storage for more details).
+ *
+ * @sa SparseSet<Entity>
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Entity, typename Type>
+class SparseSet<Entity, Type>: public SparseSet<Entity> {
+    using underlying_type = SparseSet<Entity>;
+    using traits_type = entt_traits<Entity>;
+    using storage_type = std::conditional_t<
+        column_storage<Type>::value && !std::is_empty<Type>::value,
+        internal::ColumnStorage<Type>,
+        std::conditional_t<
+            stable_storage<Type>::value && !std::is_empty<Type>::value,
+            internal::ChunkedStorage<Type>,
+            std::vector<Type, Allocator<Type>>
+        >
+    >;
+
+    // objects stored in columns are built on demand and returned by copy
+    using columnar = std::is_same<storage_type, internal::ColumnStorage<Type>>;
+    using tracked = change_ticks<Type>;
+    using ticks_type = std::vector<typename underlying_type::tick_type, Allocator<typename underlying_type::tick_type>>;
+
+    template<bool Const>
+    class Iterator final {
+        friend class SparseSet<Entity, Type>;
+
+        using instance_type = std::conditional_t<Const, const storage_type, storage_type>;
+        using index_type = typename traits_type::difference_type;
+
+        Iterator(instance_type *instances, index_type index) ENTT_NOEXCEPT
+            : instances{instances}, index{index}
+        {}
+
+    public:
+        using difference_type = index_type;
+        using value_type = std::conditional_t<Const, const Type, Type>;
+        using pointer = value_type *;
+        using reference = std::conditional_t<columnar::value, const Type, value_type &>;
+        using iterator_category = std::random_access_iterator_tag;
+
+        Iterator() ENTT_NOEXCEPT = default;
+
+        Iterator(const Iterator &) ENTT_NOEXCEPT = default;
+        Iterator & operator=(const Iterator &) ENTT_NOEXCEPT = default;
+
+        Iterator & operator++() ENTT_NOEXCEPT {
+            return --index, *this;
+        }
+
+        Iterator operator++(int) ENTT_NOEXCEPT {
+            Iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        Iterator & operator--() ENTT_NOEXCEPT {
+            return ++index, *this;
+        }
+
+        Iterator operator--(int) ENTT_NOEXCEPT {
+            Iterator orig = *this;
+            return --(*this), orig;
+        }
+
+        Iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            index -= value;
+            return *this;
+        }
+
+        Iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            return Iterator{instances, index-value};
+        }
+
+        inline Iterator & operator-=(const difference_type value) ENTT_NOEXCEPT {
+            return (*this += -value);
+        }
+
+        inline Iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+            return (*this + -value);
+        }
+
+        difference_type operator-(const Iterator &other) const ENTT_NOEXCEPT {
+            return other.index - index;
+        }
+
+        reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-value-1);
+            return SparseSet::at(*instances, pos, std::is_empty<Type>{});
+        }
+
+        bool operator==(const Iterator &other) const ENTT_NOEXCEPT {
+            return other.index == index;
+        }
+
+        inline bool operator!=(const Iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        bool operator<(const Iterator &other) const ENTT_NOEXCEPT {
+            return index > other.index;
+        }
+
+        bool operator>(const Iterator &other) const ENTT_NOEXCEPT {
+            return index < other.index;
+        }
+
+        inline bool operator<=(const Iterator &other) const ENTT_NOEXCEPT {
+            return !(*this > other);
+        }
+
+        inline bool operator>=(const Iterator &other) const ENTT_NOEXCEPT {
+            return !(*this < other);
+        }
+
+        pointer operator->() const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-1);
+            return &SparseSet::at(*instances, pos, std::is_empty<Type>{});
+        }
+
+        inline reference operator*() const ENTT_NOEXCEPT {
+            return operator[](0);
+        }
+
+    private:
+        instance_type *instances;
+        index_type index;
+    };
+
+    template<typename Instances>
+    static inline decltype(auto) at(Instances &instances, const std::size_t pos, std::false_type) ENTT_NOEXCEPT {
+        return instances[pos];
+    }
+
+    template<typename Instances>
+    static inline Type & at(Instances &, const std::size_t, std::true_type) ENTT_NOEXCEPT {
+        // empty types are never stored, all the entities share the same instance
+        return instance;
+    }
+
+    template<typename... Args>
+    inline decltype(auto) emplace(std::false_type, Args &&... args) {
+        instances.emplace_back(std::forward<Args>(args)...);
+        return instances.back();
+    }
+
+    template<typename... Args>
+    inline Type & emplace(std::true_type, Args &&... args) {
+        static_assert(std::is_default_constructible<Type>::value, "!");
+        // the object is built anyway, so that side effects aren't lost
+        static_cast<void>(Type(std::forward<Args>(args)...));
+        return instance;
+    }
+
+    static void pop(std::vector<Type, Allocator<Type>> &instances, const std::size_t pos) {
+        // swapping isn't required here, we are getting rid of the last element
+        // however, we must protect ourselves from self assignments (see #37)
+        auto tmp = std::move(instances.back());
+        instances[pos] = std::move(tmp);
+        instances.pop_back();
+    }
+
+    static void pop(internal::ChunkedStorage<Type> &instances, const std::size_t pos) {
+        instances.erase(pos);
+    }
+
+    static void pop(internal::ColumnStorage<Type> &instances, const std::size_t pos) {
+        instances.erase(pos);
+    }
+
+    static void relocate(std::vector<Type, Allocator<Type>> &instances, const std::size_t from, const std::size_t to) {
+        instances[to] = std::move(instances[from]);
+    }
+
+    template<typename Instances>
+    static void relocate(Instances &instances, const std::size_t from, const std::size_t to) {
+        // objects in chunks don't move and columns are swapped field by field
+        instances.swap(from, to);
+    }
+
+    static void shrink(std::vector<Type, Allocator<Type>> &instances, const std::size_t length) {
+        instances.erase(instances.begin() + length, instances.end());
+    }
+
+    template<typename Instances>
+    static void shrink(Instances &instances, const std::size_t length) {
+        while(length < instances.size()) {
+            instances.erase(instances.size() - 1);
+        }
+    }
+
+    static void exchange(std::vector<Type, Allocator<Type>> &instances, const std::size_t lhs, const std::size_t rhs) {
+        std::swap(instances[lhs], instances[rhs]);
+    }
+
+    static void exchange(internal::ChunkedStorage<Type> &instances, const std::size_t lhs, const std::size_t rhs) {
+        instances.swap(lhs, rhs);
+    }
+
+    static void exchange(internal::ColumnStorage<Type> &instances, const std::size_t lhs, const std::size_t rhs) {
+        instances.swap(lhs, rhs);
+    }
+
+    static void append(std::vector<Type, Allocator<Type>> &instances, const std::size_t length, const Type &value) {
+        instances.insert(instances.end(), length, value);
+    }
+
+    static void append(internal::ChunkedStorage<Type> &instances, const std::size_t length, const Type &value) {
+        instances.reserve(instances.size() + length);
+
+        for(auto pos = length; pos; --pos) {
+            instances.emplace_back(value);
+        }
+    }
+
+    static void append(internal::ColumnStorage<Type> &instances, const std::size_t length, const Type &value) {
+        instances.insert(length, value);
+    }
+
+    template<typename It>
+    static void extend(std::vector<Type, Allocator<Type>> &instances, It from, const std::size_t length) {
+        internal::extend(instances, from, length);
+    }
+
+    template<typename It, typename Instances>
+    static void extend(Instances &instances, It from, const std::size_t length) {
+        instances.reserve(instances.size() + length);
+
+        for(auto pos = length; pos; --pos) {
+            instances.emplace_back(*(from++));
+        }
+    }
+
+    template<typename Instances>
+    static void overwrite(Instances &instances, const std::size_t pos, Type value) {
+        at(instances, pos, std::is_empty<Type>{}) = std::move(value);
+    }
+
+    static void overwrite(internal::ColumnStorage<Type> &instances, const std::size_t pos, Type value) {
+        instances.assign(pos, value);
+    }
+
+    template<typename Instances>
+    static void commit(Instances &, const std::size_t, const Type &) ENTT_NOEXCEPT {}
+
+    static void commit(internal::ColumnStorage<Type> &instances, const std::size_t pos, const Type &value) {
+        instances.assign(pos, value);
+    }
+
+    template<typename... Args>
+    static constexpr bool nothrow(std::true_type) ENTT_NOEXCEPT {
+        return std::is_nothrow_constructible<Type, Args...>::value;
+    }
+
+    template<typename... Args>
+    static constexpr bool nothrow(std::false_type) ENTT_NOEXCEPT {
+        return noexcept(Type{std::declval<Args>()...});
+    }
+
+    // arguments can refer to the old object, only scalars are safe to copy aside
+    template<typename... Args>
+    using scalars = std::is_same<
+        std::integer_sequence<bool, true, std::is_scalar<std::decay_t<Args>>::value...>,
+        std::integer_sequence<bool, std::is_scalar<std::decay_t<Args>>::value..., true>
+    >;
+
+    // objects are rebuilt in place only if a failure cannot leave a hole behind
+    template<typename... Args>
+    using in_place = std::integral_constant<bool, scalars<Args...>::value && nothrow<Args...>(std::is_constructible<Type, Args...>{}) && !columnar::value && !std::is_empty<Type>::value>;
+
+    // arguments are taken by copy, so that they are read before the old object is destroyed
+    template<typename... Args>
+    std::enable_if_t<std::is_constructible<Type, Args...>::value>
+    rebuild(const std::size_t pos, std::true_type, const Args... args) ENTT_NOEXCEPT {
+        auto *instance = &instances[pos];
+        instance->~Type();
+        new (instance) Type(args...);
+    }
+
+    template<typename... Args>
+    std::enable_if_t<!std::is_constructible<Type, Args...>::value>
+    rebuild(const std::size_t pos, std::true_type, const Args... args) ENTT_NOEXCEPT {
+        auto *instance = &instances[pos];
+        instance->~Type();
+        new (instance) Type{args...};
+    }
+
+    template<typename... Args>
+    std::enable_if_t<std::is_constructible<Type, Args...>::value>
+    rebuild(const std::size_t pos, std::false_type, Args &&... args) {
+        overwrite(instances, pos, Type(std::forward<Args>(args)...));
+    }
+
+    template<typename... Args>
+    std::enable_if_t<!std::is_constructible<Type, Args...>::value>
+    rebuild(const std::size_t pos, std::false_type, Args &&... args) {
+        overwrite(instances, pos, Type{std::forward<Args>(args)...});
+    }
+
+    static void copy(std::vector<Type, Allocator<Type>> &instances, const std::vector<Type, Allocator<Type>> &other) {
+        internal::replicate(instances, other);
+    }
+
+    static void copy(internal::ChunkedStorage<Type> &instances, const internal::ChunkedStorage<Type> &other) {
+        instances.copy(other);
+    }
+
+    static void copy(internal::ColumnStorage<Type> &instances, const internal::ColumnStorage<Type> &other) {
+        instances.copy(other);
+    }
+
+    static void compact(std::vector<Type, Allocator<Type>> &) {}
+
+    static void compact(internal::ChunkedStorage<Type> &instances) {
+        instances.compact();
+    }
+
+    static void compact(internal::ColumnStorage<Type> &) {}
+
+    void exchange(const std::size_t lhs, const std::size_t rhs) {
+        if(!std::is_empty<Type>::value) {
+            exchange(instances, lhs, rhs);
+        }
+
+        if(tracked::value) {
+            std::swap(stamps[lhs], stamps[rhs]);
+        }
+    }
+
+public:
+    /*! @brief Type of the objects associated to the entities. */
+    using object_type = Type;
+    /**
+     * @brief Type returned when accessing the objects.
+     *
+     * Objects stored in columns are returned as const copies, so that attempts
+     * to modify them through a copy don't compile.
+     */
+    using reference_type = std::conditional_t<columnar::value, const Type, Type &>;
+    /*! @brief Type returned when accessing the objects of a const set. */
+    using const_reference_type = std::conditional_t<columnar::value, const Type, const Type &>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename underlying_type::size_type;
+    /*! @brief Unsigned integer type used for change ticks. */
+    using tick_type = typename underlying_type::tick_type;
+    /*! @brief Input iterator type. */
+    using iterator_type = Iterator<false>;
+    /*! @brief Constant input iterator type. */
+    using const_iterator_type = Iterator<true>;
+
+    /*! @brief Default constructor. */
+    SparseSet() ENTT_NOEXCEPT = default;
+
+    /**
+     * @brief Constructs a sparse set that gets memory from the given resource.
+     * @param resource A memory resource, if any.
+     */
+    explicit SparseSet(MemoryResource *resource) ENTT_NOEXCEPT
+        : underlying_type{resource}, instances(resource), stamps(resource)
+    {}
+
+    /*! @brief Copying a sparse set isn't allowed. */
+    SparseSet(const SparseSet &) = delete;
+    /*! @brief Default move constructor. */
+    SparseSet(SparseSet &&) = default;
+
+    /*! @brief Copying a sparse set isn't allowed. @return This sparse set. */
     SparseSet & operator=(const SparseSet &) = delete;
     /*! @brief Default move assignment operator. @return This sparse set. */
     SparseSet & operator=(SparseSet &&) = default;
@@ -717,14 +1721,23 @@ public:
      */
     void reserve(const size_type cap) {
         underlying_type::reserve(cap);
-        instances.reserve(cap);
+
+        if(!std::is_empty<Type>::value) {
+            instances.reserve(cap);
+        }
+
+        if(tracked::value) {
+            stamps.reserve(cap);
+        }
     }
 
     /**
      * @brief Direct access to the array of objects.
      *
-     * The returned pointer is such that range `[raw(), raw() + size()]` is
-     * always a valid range, even if the container is empty.
+     * When objects are stored in a contiguous array (that is, the default), the
+     * returned pointer is such that range `[raw(), raw() + size()]` is always a
+     * valid range, even if the container is empty. There are no guarantees in
+     * all the other cases.
      *
      * @note
      * There are no guarantees on the order, even though either `sort` or
@@ -733,17 +1746,32 @@ public:
      * performance boost but less guarantees. Use `begin` and `end` if you want
      * to iterate the sparse set in the expected order.
      *
+     * @warning
+     * Empty types aren't stored. In this case, the returned pointer refers to
+     * the instance shared by all the entities of all the sparse sets for the
+     * given type, the range `[raw(), raw() + size()]` isn't valid and only
+     * `*raw()` is a valid expression.<br/>
+     * Objects of types for which pointer-stable storage has been requested are
+     * stored in chunks. In this case, the returned pointer refers to the first
+     * chunk, if any, and it cannot be used to reach the objects in the other
+     * chunks. Within the first chunk, it's in sync with `data` only after a
+     * call to `compact`.<br/>
+     * Objects of types stored in columns don't exist as such in memory and this
+     * function isn't available for them. Use `column` instead.
+     *
      * @return A pointer to the array of objects.
      */
     const object_type * raw() const ENTT_NOEXCEPT {
-        return instances.data();
+        return std::is_empty<Type>::value ? &at(instances, 0, std::is_empty<Type>{}) : instances.data();
     }
 
     /**
      * @brief Direct access to the array of objects.
      *
-     * The returned pointer is such that range `[raw(), raw() + size()]` is
-     * always a valid range, even if the container is empty.
+     * When objects are stored in a contiguous array (that is, the default), the
+     * returned pointer is such that range `[raw(), raw() + size()]` is always a
+     * valid range, even if the container is empty. There are no guarantees in
+     * all the other cases.
      *
      * @note
      * There are no guarantees on the order, even though either `sort` or
@@ -752,10 +1780,23 @@ public:
      * performance boost but less guarantees. Use `begin` and `end` if you want
      * to iterate the sparse set in the expected order.
      *
+     * @warning
+     * Empty types aren't stored. In this case, the returned pointer refers to
+     * the instance shared by all the entities of all the sparse sets for the
+     * given type, the range `[raw(), raw() + size()]` isn't valid and only
+     * `*raw()` is a valid expression.<br/>
+     * Objects of types for which pointer-stable storage has been requested are
+     * stored in chunks. In this case, the returned pointer refers to the first
+     * chunk, if any, and it cannot be used to reach the objects in the other
+     * chunks. Within the first chunk, it's in sync with `data` only after a
+     * call to `compact`.<br/>
+     * Objects of types stored in columns don't exist as such in memory and this
+     * function isn't available for them. Use `column` instead.
+     *
      * @return A pointer to the array of objects.
      */
-    object_type * raw() ENTT_NOEXCEPT {
-        return instances.data();
+    inline object_type * raw() ENTT_NOEXCEPT {
+        return const_cast<object_type *>(const_cast<const SparseSet *>(this)->raw());
     }
 
     /**
@@ -771,7 +1812,7 @@ public:
      * @return An iterator to the first instance of the given type.
      */
     const_iterator_type cbegin() const ENTT_NOEXCEPT {
-        const typename traits_type::difference_type pos = instances.size();
+        const typename traits_type::difference_type pos = underlying_type::size();
         return const_iterator_type{&instances, pos};
     }
 
@@ -804,7 +1845,7 @@ public:
      * @return An iterator to the first instance of the given type.
      */
     iterator_type begin() ENTT_NOEXCEPT {
-        const typename traits_type::difference_type pos = instances.size();
+        const typename traits_type::difference_type pos = underlying_type::size();
         return iterator_type{&instances, pos};
     }
 
@@ -867,7 +1908,7 @@ public:
      * @param pos Position of the element to return.
      * @return A reference to the requested element.
      */
-    inline const object_type & operator[](const size_type pos) const ENTT_NOEXCEPT {
+    inline const_reference_type operator[](const size_type pos) const ENTT_NOEXCEPT {
         return cbegin()[pos];
     }
 
@@ -876,8 +1917,8 @@ public:
      * @param pos Position of the element to return.
      * @return A reference to the requested element.
      */
-    inline object_type & operator[](const size_type pos) ENTT_NOEXCEPT {
-        return const_cast<object_type &>(const_cast<const SparseSet *>(this)->operator[](pos));
+    inline reference_type operator[](const size_type pos) ENTT_NOEXCEPT {
+        return begin()[pos];
     }
 
     /**
@@ -892,8 +1933,8 @@ public:
      * @param entity A valid entity identifier.
      * @return The object associated to the entity.
      */
-    const object_type & get(const entity_type entity) const ENTT_NOEXCEPT {
-        return instances[underlying_type::get(entity)];
+    const_reference_type get(const entity_type entity) const ENTT_NOEXCEPT {
+        return at(instances, underlying_type::get(entity), std::is_empty<Type>{});
     }
 
     /**
@@ -908,8 +1949,129 @@ public:
      * @param entity A valid entity identifier.
      * @return The object associated to the entity.
      */
-    inline object_type & get(const entity_type entity) ENTT_NOEXCEPT {
-        return const_cast<object_type &>(const_cast<const SparseSet *>(this)->get(entity));
+    inline reference_type get(const entity_type entity) ENTT_NOEXCEPT {
+        return at(instances, underlying_type::get(entity), std::is_empty<Type>{});
+    }
+
+    /**
+     * @brief Direct access to the column of a data member.
+     *
+     * The returned pointer is such that range `[column(member), column(member)
+     * + size()]` is always a valid range, even if the container is empty.<br/>
+     * Columns are in sync with each other and with the array of entities, that
+     * is, the i-th element of a column belongs to the i-th entity returned by
+     * `data`.
+     *
+     * @note
+     * There are no guarantees on the order, even though either `sort` or
+     * `respect` has been previously invoked. See `raw` for more details.
+     *
+     * @warning
+     * This function is available only for types stored in columns (see
+     * column_storage for more details).<br/>
+     * Attempting to get the column of a data member that isn't listed results
+     * in undefined behavior. An assertion will abort the execution at runtime
+     * in debug mode in this case.
+     *
+     * @tparam Field Type of the data member.
+     * @tparam Object Type of objects to which the data member belongs.
+     * @param member A pointer to a data member of the given type.
+     * @return A pointer to the array of values of the data member.
+     */
+    template<typename Field, typename Object>
+    const Field * column(Field Object:: *member) const ENTT_NOEXCEPT {
+        static_assert(columnar::value && std::is_same<Object, Type>::value, "!");
+        return instances.column(member);
+    }
+
+    /**
+     * @brief Direct access to the column of a data member.
+     *
+     * The returned pointer is such that range `[column(member), column(member)
+     * + size()]` is always a valid range, even if the container is empty.<br/>
+     * Columns are in sync with each other and with the array of entities, that
+     * is, the i-th element of a column belongs to the i-th entity returned by
+     * `data`.
+     *
+     * @note
+     * There are no guarantees on the order, even though either `sort` or
+     * `respect` has been previously invoked. See `raw` for more details.
+     *
+     * @warning
+     * This function is available only for types stored in columns (see
+     * column_storage for more details).<br/>
+     * Attempting to get the column of a data member that isn't listed results
+     * in undefined behavior. An assertion will abort the execution at runtime
+     * in debug mode in this case.
+     *
+     * @tparam Field Type of the data member.
+     * @tparam Object Type of objects to which the data member belongs.
+     * @param member A pointer to a data member of the given type.
+     * @return A pointer to the array of values of the data member.
+     */
+    template<typename Field, typename Object>
+    inline Field * column(Field Object:: *member) ENTT_NOEXCEPT {
+        return const_cast<Field *>(const_cast<const SparseSet *>(this)->column(member));
+    }
+
+    /**
+     * @brief Direct access to the array of change ticks.
+     *
+     * The returned pointer is such that range `[ticks(), ticks() + size()]` is
+     * always a valid range, even if the container is empty.<br/>
+     * Ticks are in sync with the array of entities, that is, the i-th tick
+     * belongs to the i-th entity returned by `data`.
+     *
+     * @warning
+     * This function is available only for types for which change ticks have
+     * been requested (see change_ticks for more details).
+     *
+     * @return A pointer to the array of change ticks.
+     */
+    const tick_type * ticks() const ENTT_NOEXCEPT {
+        static_assert(tracked::value, "!");
+        return stamps.data();
+    }
+
+    /**
+     * @brief Returns the change tick of the object associated to an entity.
+     *
+     * @warning
+     * This function is available only for types for which change ticks have
+     * been requested (see change_ticks for more details).<br/>
+     * Attempting to use an entity that doesn't belong to the sparse set results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set doesn't contain the given entity.
+     *
+     * @param entity A valid entity identifier.
+     * @return The change tick of the object associated to the entity.
+     */
+    tick_type tick(const entity_type entity) const ENTT_NOEXCEPT {
+        static_assert(tracked::value, "!");
+        return stamps[underlying_type::get(entity)];
+    }
+
+    /**
+     * @brief Stamps the object associated to an entity with a change tick.
+     *
+     * Objects are stamped with a null tick when they are created. Stamping them
+     * is up to the users.
+     *
+     * @warning
+     * This function is available only for types for which change ticks have
+     * been requested (see change_ticks for more details).<br/>
+     * Attempting to use an entity that doesn't belong to the sparse set results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set doesn't contain the given entity.
+     *
+     * @param entity A valid entity identifier.
+     * @param tick The change tick to assign to the object.
+     */
+    void stamp(const entity_type entity, const tick_type tick) ENTT_NOEXCEPT {
+        static_assert(tracked::value, "!");
+        stamps[underlying_type::get(entity)] = tick;
     }
 
     /**
@@ -933,11 +2095,15 @@ public:
      * @return The object associated to the entity.
      */
     template<typename... Args>
-    std::enable_if_t<std::is_constructible<Type, Args...>::value, object_type &>
+    std::enable_if_t<std::is_constructible<Type, Args...>::value, reference_type>
     construct(const entity_type entity, Args &&... args) {
         underlying_type::construct(entity);
-        instances.emplace_back(std::forward<Args>(args)...);
-        return instances.back();
+
+        if(tracked::value) {
+            stamps.emplace_back();
+        }
+
+        return emplace(std::is_empty<Type>{}, std::forward<Args>(args)...);
     }
 
     /**
@@ -961,11 +2127,158 @@ public:
      * @return The object associated to the entity.
      */
     template<typename... Args>
-    std::enable_if_t<!std::is_constructible<Type, Args...>::value, object_type &>
+    std::enable_if_t<!std::is_constructible<Type, Args...>::value, reference_type>
     construct(const entity_type entity, Args &&... args) {
         underlying_type::construct(entity);
-        instances.emplace_back(Type{std::forward<Args>(args)...});
-        return instances.back();
+
+        if(tracked::value) {
+            stamps.emplace_back();
+        }
+
+        return emplace(std::is_empty<Type>{}, Type{std::forward<Args>(args)...});
+    }
+
+    /**
+     * @brief Assigns a range of entities to a sparse set and copies the given
+     * object for each of them.
+     *
+     * Memory is reserved once for the whole range, then entities and objects
+     * are added to the sparse set in a single pass. It's faster than assigning
+     * entities one at a time.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used only if the iterators refer to entity identifiers.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the sparse set
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set already contains one of the given entities.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An object to copy for each entity.
+     */
+    template<typename It>
+    std::enable_if_t<std::is_same<std::decay_t<decltype(*std::declval<It>())>, entity_type>::value>
+    construct(It first, It last, const object_type &value = {}) {
+        if(!std::is_empty<Type>::value) {
+            append(instances, std::distance(first, last), value);
+        }
+
+        if(tracked::value) {
+            stamps.insert(stamps.end(), std::distance(first, last), tick_type{});
+        }
+
+        underlying_type::construct(first, last);
+    }
+
+    /**
+     * @brief Assigns a range of entities to a sparse set and copies the
+     * objects of another range for them.
+     *
+     * Memory is reserved once for the whole range, then entities and objects
+     * are added to the sparse set in a single pass. The i-th entity of the
+     * range is given a copy of the i-th object of the other range. In case the
+     * objects are trivially copyable and contiguous (that is, `from` is a
+     * pointer), they are copied with a `memcpy`.
+     *
+     * @note
+     * _Sfinae'd_ function.<br/>
+     * This version is used only if the iterators refer to entity identifiers
+     * and the other iterator refers to objects of the sparse set type.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the sparse set
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set already contains one of the given entities.
+     *
+     * @tparam It Type of forward iterator.
+     * @tparam Other Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     */
+    template<typename It, typename Other>
+    std::enable_if_t<std::is_same<std::decay_t<decltype(*std::declval<It>())>, entity_type>::value && std::is_same<std::decay_t<decltype(*std::declval<Other>())>, object_type>::value>
+    construct(It first, It last, Other from) {
+        const auto length = size_type(std::distance(first, last));
+
+        if(!std::is_empty<Type>::value) {
+            extend(instances, from, length);
+        }
+
+        if(tracked::value) {
+            stamps.insert(stamps.end(), length, tick_type{});
+        }
+
+        underlying_type::construct(first, last);
+    }
+
+    /**
+     * @brief Replaces the object associated to an entity.
+     *
+     * The new object is constructed directly in place of the old one whenever
+     * this cannot throw and all the arguments are scalars, that are copied
+     * before the old object is destroyed. Otherwise a temporary object is
+     * created from the arguments provided and then moved into the sparse set,
+     * so that arguments can safely refer to the old object or its members.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the sparse set results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set doesn't contain the given entity.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entity A valid entity identifier.
+     * @param args Parameters to use to construct the object.
+     * @return The object associated to the entity.
+     */
+    template<typename... Args>
+    reference_type replace(const entity_type entity, Args &&... args) {
+        const auto pos = underlying_type::get(entity);
+        rebuild(pos, in_place<Args...>{}, std::forward<Args>(args)...);
+        return at(instances, pos, std::is_empty<Type>{});
+    }
+
+    /**
+     * @brief Updates the object associated to an entity in place.
+     *
+     * The function object is invoked with a reference to the object to
+     * update. The signature of the function should be equivalent to the
+     * following:
+     *
+     * @code{.cpp}
+     * void(Type &);
+     * @endcode
+     *
+     * @note
+     * Objects stored in columns are built on demand. The function object
+     * receives a copy of the object that is then written back to the columns.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the sparse set results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set doesn't contain the given entity.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param entity A valid entity identifier.
+     * @param func A valid function object.
+     * @return The object associated to the entity.
+     */
+    template<typename Func>
+    reference_type patch(const entity_type entity, Func func) {
+        const auto pos = underlying_type::get(entity);
+        // objects stored in columns are patched through a mutable copy
+        std::conditional_t<columnar::value, Type, Type &> instance = at(instances, pos, std::is_empty<Type>{});
+        func(instance);
+        commit(instances, pos, instance);
+        return instance;
     }
 
     /**
@@ -980,14 +2293,94 @@ public:
      * @param entity A valid entity identifier.
      */
     void destroy(const entity_type entity) override {
-        // swapping isn't required here, we are getting rid of the last element
-        // however, we must protect ourselves from self assignments (see #37)
-        auto tmp = std::move(instances.back());
-        instances[underlying_type::get(entity)] = std::move(tmp);
-        instances.pop_back();
+        if(!std::is_empty<Type>::value) {
+            pop(instances, underlying_type::get(entity));
+        }
+
+        if(tracked::value) {
+            stamps[underlying_type::get(entity)] = stamps.back();
+            stamps.pop_back();
+        }
+
         underlying_type::destroy(entity);
     }
 
+    /**
+     * @brief Removes a range of entities from a sparse set and destroies their
+     * objects.
+     *
+     * Objects follow their entities while the holes left in the packed arrays
+     * are filled with the elements found at their end. Each object is moved at
+     * most once, then the ones that belong to the given entities are destroyed
+     * all together.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the sparse set or to
+     * remove the same entity more than once results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set doesn't contain one of the given entities.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void destroy(It first, It last) {
+        const auto length = underlying_type::compact(first, last, [this](const auto from, const auto to) {
+            if(!std::is_empty<Type>::value) {
+                relocate(instances, from, to);
+            }
+
+            if(tracked::value) {
+                stamps[to] = stamps[from];
+            }
+        });
+
+        if(!std::is_empty<Type>::value) {
+            shrink(instances, length);
+        }
+
+        if(tracked::value) {
+            stamps.resize(length);
+        }
+    }
+
+    /**
+     * @brief Removes a contiguous range of entities from a sparse set and
+     * destroies their objects.
+     *
+     * @sa destroy
+     *
+     * @param first A pointer to the first element of the range of entities.
+     * @param last A pointer past the last element of the range of entities.
+     */
+    void destroy(const entity_type *first, const entity_type *last) override {
+        destroy<const entity_type *>(first, last);
+    }
+
+    /**
+     * @brief Swaps the position of two entities and their objects in the
+     * internal packed arrays.
+     *
+     * Objects follow the entities to which they belong, therefore the sparse
+     * set is consistent after a swap and the two elements are simply returned
+     * in a different order when iterated.
+     *
+     * @warning
+     * Attempting to swap entities that don't belong to the sparse set results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * sparse set doesn't contain the given entities.
+     *
+     * @param lhs A valid position within the sparse set.
+     * @param rhs A valid position within the sparse set.
+     */
+    void swap(const size_type lhs, const size_type rhs) {
+        exchange(lhs, rhs);
+        underlying_type::swap(lhs, rhs);
+    }
+
     /**
      * @brief Sort components according to the given comparison function.
      *
@@ -1022,6 +2415,10 @@ public:
      * either `data` or `raw` gives no guarantees on the order, even though
      * `sort` has been invoked.
      *
+     * @note
+     * Sorting a sparse set of empty objects has no effect, all the elements
+     * are equivalent to each other.
+     *
      * @tparam Compare Type of comparison function object.
      * @tparam Sort Type of sort function object.
      * @tparam Args Types of arguments to forward to the sort function object.
@@ -1031,11 +2428,15 @@ public:
      */
     template<typename Compare, typename Sort = StdSort, typename... Args>
     void sort(Compare compare, Sort sort = Sort{}, Args &&... args) {
+        if(std::is_empty<Type>::value) {
+            return;
+        }
+
         std::vector<size_type> copy(instances.size());
         std::iota(copy.begin(), copy.end(), 0);
 
         sort(copy.begin(), copy.end(), [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
-            return compare(const_cast<const object_type &>(instances[rhs]), const_cast<const object_type &>(instances[lhs]));
+            return compare(static_cast<const_reference_type>(instances[rhs]), static_cast<const_reference_type>(instances[lhs]));
         }, std::forward<Args>(args)...);
 
         for(size_type pos = 0, last = copy.size(); pos < last; ++pos) {
@@ -1045,7 +2446,7 @@ public:
             while(curr != next) {
                 const auto lhs = copy[curr];
                 const auto rhs = copy[next];
-                std::swap(instances[lhs], instances[rhs]);
+                exchange(lhs, rhs);
                 underlying_type::swap(lhs, rhs);
                 copy[curr] = curr;
                 curr = next;
@@ -1090,7 +2491,7 @@ public:
             if(underlying_type::has(curr)) {
                 if(curr != *(local + pos)) {
                     auto candidate = underlying_type::get(curr);
-                    std::swap(instances[pos], instances[candidate]);
+                    exchange(pos, candidate);
                     underlying_type::swap(pos, candidate);
                 }
 
@@ -1101,19 +2502,67 @@ public:
         }
     }
 
+    /**
+     * @brief Compacts the objects of a sparse set.
+     *
+     * Objects are laid out in the same order of the entities, so that they can
+     * be iterated in a cache-friendly way and holes left by removed objects are
+     * filled in.<br/>
+     * It has no effect unless pointer-stable storage has been requested for the
+     * given type (see stable_storage for more details). In this case, it's the
+     * only function that moves objects around and therefore pointers and
+     * references to them are invalidated.
+     *
+     * @warning
+     * Objects of types that are neither move constructible nor move assignable
+     * cannot be compacted. A compilation error will occur in this case.
+     */
+    void compact() {
+        compact(instances);
+    }
+
+    /**
+     * @brief Copies the content of another sparse set.
+     *
+     * After the copy, a sparse set contains the same entities and copies of
+     * the same objects of the other sparse set, all of them in the same order.
+     * Change ticks are copied as well, if any.<br/>
+     * Entities, change ticks and trivially copyable objects are copied with a
+     * `memcpy` and the memory already in use is reused whenever possible. All
+     * the other objects are copy constructed.
+     *
+     * @note
+     * In case of pointer-stable storage, the objects are also compacted (see
+     * `compact` for more details).
+     *
+     * @param other The sparse set to copy.
+     */
+    void copy(const SparseSet &other) {
+        underlying_type::copy(other);
+        copy(instances, other.instances);
+        internal::replicate(stamps, other.stamps);
+    }
+
     /**
      * @brief Resets a sparse set.
      */
     void reset() override {
         underlying_type::reset();
         instances.clear();
+        stamps.clear();
     }
 
 private:
-    std::vector<object_type> instances;
+    static Type instance;
+    storage_type instances;
+    ticks_type stamps;
 };
 
 
+template<typename Entity, typename Type>
+Type SparseSet<Entity, Type>::instance{};
+
+
 }
 
 
@@ -0,0 +1,296 @@
+#ifndef ENTT_ENTITY_SYSTEM_GRAPH_HPP
+#define ENTT_ENTITY_SYSTEM_GRAPH_HPP
+
+
+#include <vector>
+#include <memory>
+#include <utility>
+#include <cassert>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
+#include "../job/job_system.hpp"
+#include "registry.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Read-only access to a set of components.
+ * @tparam Component Types of components read by a system.
+ */
+template<typename... Component>
+struct Read final {};
+
+
+/**
+ * @brief Read-write access to a set of components.
+ * @tparam Component Types of components written by a system.
+ */
+template<typename... Component>
+struct Write final {};
+
+
+/**
+ * @brief System graph.
+ *
+ * A system graph runs systems that declare what components they read and what
+ * components they write. Two systems conflict if one of them writes a type of
+ * component that the other one either reads or writes. Conflicting systems
+ * run in the order in which they were added to the graph, all the others can
+ * run in parallel.
+ *
+ * Example of use:
+ *
+ * @code{.cpp}
+ * entt::SystemGraph<entt::DefaultRegistry::entity_type, double> graph{registry};
+ *
+ * graph.system<entt::Read<Velocity>, entt::Write<Position>>([](auto &registry, auto delta) {
+ *     // ...
+ * });
+ *
+ * graph.system<entt::Read<Position>, entt::Write<Sprite>>([](auto &registry, auto delta) {
+ *     // ...
+ * });
+ *
+ * graph.run(jobs, delta);
+ * @endcode
+ *
+ * The signature of the function call operator of a system should be
+ * equivalent to the following:
+ *
+ * @code{.cpp}
+ * void(Registry<Entity> &registry, Delta delta);
+ * @endcode
+ *
+ * Pools for the declared components are created when the systems are added to
+ * the graph, so that systems can get views and access components concurrently
+ * without modifying the registry.
+ *
+ * @warning
+ * Systems that run in parallel must neither create nor destroy entities and
+ * must neither assign nor remove components. Only the components declared
+ * with `Write` can be modified in place and listeners of their update signals
+ * must be thread-safe.<br/>
+ * Standard views can be created freely within systems. Persistent views can't,
+ * the first time a persistent view is requested the registry connects its
+ * handlers to the pools and this isn't thread-safe. Prepare them up front (see
+ * `Registry::prepare`) or create them outside the systems that run in parallel.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Delta Type to use to provide elapsed time.
+ */
+template<typename Entity, typename Delta>
+class SystemGraph final {
+    using component_type = typename Registry<Entity>::component_type;
+
+    struct Node final {
+        using instance_type = std::unique_ptr<void, void(*)(void *)>;
+        using invoke_fn_type = void(void *, Registry<Entity> &, Delta);
+
+        instance_type instance;
+        invoke_fn_type *invoke;
+        std::vector<component_type> reads;
+        std::vector<component_type> writes;
+        std::vector<std::size_t> dependencies;
+    };
+
+    template<typename Func>
+    static void invoke(void *instance, Registry<Entity> &registry, const Delta delta) {
+        (*static_cast<Func *>(instance))(registry, delta);
+    }
+
+    template<typename Func>
+    static void deleter(void *instance) {
+        delete static_cast<Func *>(instance);
+    }
+
+    static bool intersect(const std::vector<component_type> &lhs, const std::vector<component_type> &rhs) ENTT_NOEXCEPT {
+        // both the lists are sorted, a linear scan is enough
+        auto first = lhs.cbegin();
+        auto other = rhs.cbegin();
+
+        while(first != lhs.cend() && other != rhs.cend()) {
+            if(*first < *other) {
+                ++first;
+            } else if(*other < *first) {
+                ++other;
+            } else {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool conflict(const Node &lhs, const Node &rhs) ENTT_NOEXCEPT {
+        return intersect(lhs.writes, rhs.writes) || intersect(lhs.writes, rhs.reads) || intersect(lhs.reads, rhs.writes);
+    }
+
+    template<typename... Component>
+    void declare(Read<Component...>, Node &node) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (registry->template assure<Component>(), node.reads.push_back(registry->template type<Component>()), 0)... };
+        (void)accumulator;
+    }
+
+    template<typename... Component>
+    void declare(Write<Component...>, Node &node) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (registry->template assure<Component>(), node.writes.push_back(registry->template type<Component>()), 0)... };
+        (void)accumulator;
+    }
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = Registry<Entity>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a system graph that is bound to a given registry.
+     * @param registry A valid reference to a registry.
+     */
+    explicit SystemGraph(Registry<Entity> &registry)
+        : registry{&registry}
+    {}
+
+    /*! @brief Copying a system graph isn't allowed. */
+    SystemGraph(const SystemGraph &) = delete;
+    /*! @brief Default move constructor. */
+    SystemGraph(SystemGraph &&) = default;
+
+    /*! @brief Copying a system graph isn't allowed. @return This system graph. */
+    SystemGraph & operator=(const SystemGraph &) = delete;
+    /*! @brief Default move assignment operator. @return This system graph. */
+    SystemGraph & operator=(SystemGraph &&) = default;
+
+    /**
+     * @brief Number of systems in the graph.
+     * @return Number of systems in the graph.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return nodes.size();
+    }
+
+    /**
+     * @brief Returns true if the graph contains no systems.
+     * @return True if the graph is empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return nodes.empty();
+    }
+
+    /*! @brief Discards all the systems. */
+    void clear() {
+        nodes.clear();
+    }
+
+    /**
+     * @brief Adds a system to the graph.
+     *
+     * Access lists are provided in the form of `Read` and `Write` types. A
+     * system depends on all the systems added before it with which it
+     * conflicts. Declaring a component both as read and as written is the same
+     * as declaring it only as written.
+     *
+     * @tparam Access Access lists of the system.
+     * @tparam Func Type of system to add.
+     * @param func Either a lambda or a functor to use as a system.
+     * @return This system graph.
+     */
+    template<typename... Access, typename Func>
+    SystemGraph & system(Func &&func) {
+        using system_type = std::decay_t<Func>;
+
+        Node node{typename Node::instance_type{new system_type{std::forward<Func>(func)}, &SystemGraph::deleter<system_type>}, &SystemGraph::invoke<system_type>, {}, {}, {}};
+
+        using accumulator_type = int[];
+        accumulator_type accumulator = { 0, (declare(Access{}, node), 0)... };
+        (void)accumulator;
+
+        std::sort(node.reads.begin(), node.reads.end());
+        node.reads.erase(std::unique(node.reads.begin(), node.reads.end()), node.reads.end());
+        std::sort(node.writes.begin(), node.writes.end());
+        node.writes.erase(std::unique(node.writes.begin(), node.writes.end()), node.writes.end());
+
+        for(size_type pos{}, last = nodes.size(); pos < last; ++pos) {
+            if(conflict(nodes[pos], node)) {
+                node.dependencies.push_back(pos);
+            }
+        }
+
+        nodes.push_back(std::move(node));
+        return *this;
+    }
+
+    /**
+     * @brief Returns the systems on which the given system depends.
+     *
+     * Systems are identified by the order in which they were added to the
+     * graph.
+     *
+     * @param pos Index of a system.
+     * @return The indexes of the systems on which the given one depends.
+     */
+    const std::vector<size_type> & dependencies(const size_type pos) const ENTT_NOEXCEPT {
+        assert(pos < nodes.size());
+        return nodes[pos].dependencies;
+    }
+
+    /**
+     * @brief Runs all the systems sequentially.
+     *
+     * Systems run in the order in which they were added to the graph.
+     *
+     * @param delta Elapsed time.
+     */
+    void run(const Delta delta) {
+        for(auto &&node: nodes) {
+            node.invoke(node.instance.get(), *registry, delta);
+        }
+    }
+
+    /**
+     * @brief Runs all the systems in parallel.
+     *
+     * Each system is spawned as a job that depends on the jobs of the systems
+     * with which it conflicts. The function returns when all the systems have
+     * been executed.
+     *
+     * @param jobs A valid job system.
+     * @param delta Elapsed time.
+     */
+    void run(JobSystem &jobs, const Delta delta) {
+        std::vector<JobSystem::Handle> handles;
+        std::vector<JobSystem::Handle> after;
+        handles.reserve(nodes.size());
+
+        for(auto &&node: nodes) {
+            after.clear();
+
+            for(const auto pos: node.dependencies) {
+                after.push_back(handles[pos]);
+            }
+
+            handles.push_back(jobs.spawn(after.cbegin(), after.cend(), [this, &node, delta]() {
+                node.invoke(node.instance.get(), *registry, delta);
+            }));
+        }
+
+        for(auto &&handle: handles) {
+            jobs.wait(handle);
+        }
+    }
+
+private:
+    Registry<Entity> *registry;
+    std::vector<Node> nodes;
+};
+
+
+}
+
+
+#endif // ENTT_ENTITY_SYSTEM_GRAPH_HPP
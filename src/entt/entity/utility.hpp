@@ -17,6 +17,26 @@ struct persistent_t final {};
 struct raw_t final {};
 
 
+/*! @brief Concurrent creation type used to disambiguate overloads. */
+struct concurrent_t final {};
+
+
+/**
+ * @brief Exclusion list type used to filter views.
+ * @tparam Type Types of components to exclude.
+ */
+template<typename... Type>
+struct exclude_t final {};
+
+
+/**
+ * @brief Variable template for exclusion lists.
+ * @tparam Type Types of components to exclude.
+ */
+template<typename... Type>
+constexpr exclude_t<Type...> exclude{};
+
+
 }
 
 
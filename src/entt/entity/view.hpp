@@ -32,7 +32,9 @@ class Registry;
  * at least the given components. Moreover, it's guaranteed that the entity list
  * is tightly packed in memory for fast iterations.<br/>
  * In general, persistent views don't stay true to the order of any set of
- * components unless users explicitly sort them.
+ * components unless users explicitly sort them.<br/>
+ * Entities that have at least one of the components excluded when the view was
+ * created (if any) aren't part of the view at all.
  *
  * @b Important
  *
@@ -70,6 +72,11 @@ class Registry;
 template<typename Entity, typename... Component>
 class PersistentView final {
     static_assert(sizeof...(Component) > 1, "!");
+    // objects stored in columns are accessed through raw views and owning groups
+    static_assert(std::is_same<
+        std::integer_sequence<bool, true, std::is_reference<typename SparseSet<Entity, Component>::reference_type>::value...>,
+        std::integer_sequence<bool, std::is_reference<typename SparseSet<Entity, Component>::reference_type>::value..., true>
+    >::value, "!");
 
     /*! @brief A registry is allowed to create views. */
     friend class Registry<Entity>;
@@ -89,6 +96,8 @@ public:
     using entity_type = typename view_type::entity_type;
     /*! @brief Unsigned integer type. */
     using size_type = typename view_type::size_type;
+    /*! @brief Unsigned integer type used for change ticks. */
+    using tick_type = typename view_type::tick_type;
     /*! @brief Input iterator type. */
     using iterator_type = typename view_type::iterator_type;
     /*! @brief Constant input iterator type. */
@@ -394,6 +403,139 @@ public:
         });
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The shared pool of entities is split in chunks that are processed in
+     * parallel by the given executor. The function object is invoked for each
+     * entity. It is provided with the entity itself and a set of const
+     * references to all the components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @sa JobSystem::parallel_for
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of entities per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    void parallel_each(Executor &executor, Func func, const size_type grain = {}) const {
+        const auto begin = view.cbegin();
+
+        executor.parallel_for(view.size(), grain, [&func, begin, this](const auto first, const auto last) {
+            std::for_each(begin + first, begin + last, [&func, this](const auto entity) {
+                func(entity, std::get<pool_type<Component> &>(pools).get(entity)...);
+            });
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * Non-const version of the function above, the function object is
+     * provided with references to the components instead.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @sa parallel_each
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of entities per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    inline void parallel_each(Executor &executor, Func func, const size_type grain = {}) {
+        const_cast<const PersistentView *>(this)->parallel_each(executor, [&func](const entity_type entity, const Component &... component) {
+            func(entity, const_cast<Component &>(component)...);
+        }, grain);
+    }
+
+    /**
+     * @brief Iterates entities and components that changed since a given tick
+     * and applies the given function object to them.
+     *
+     * The function object is invoked only for the entities whose component of
+     * the given type has been stamped with a tick greater than or equal to the
+     * one provided. The pool of the given component is walked in place of the
+     * shared pool of entities, therefore the function object is invoked only
+     * for what changed.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @warning
+     * Attempting to use a component for which change ticks haven't been
+     * requested results in a compilation error (see change_ticks for more
+     * details).
+     *
+     * @tparam Comp Type of component of which to check the change ticks.
+     * @tparam Func Type of the function object to invoke.
+     * @param tick The tick from which to look for changes.
+     * @param func A valid function object.
+     */
+    template<typename Comp, typename Func>
+    void each_changed_since(const tick_type tick, Func func) const {
+        const auto &cpool = std::get<pool_type<Comp> &>(pools);
+        const auto *ticks = cpool.ticks();
+        auto pos = cpool.size();
+
+        // ticks are laid out as the entities while iterators walk them backwards
+        std::for_each(cpool.view_type::cbegin(), cpool.view_type::cend(), [&](const auto entity) {
+            if(ticks[--pos] >= tick && view.has(entity)) {
+                func(entity, std::get<pool_type<Component> &>(pools).get(entity)...);
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components that changed since a given tick
+     * and applies the given function object to them.
+     *
+     * The function object is invoked only for the entities whose component of
+     * the given type has been stamped with a tick greater than or equal to the
+     * one provided. The pool of the given component is walked in place of the
+     * shared pool of entities, therefore the function object is invoked only
+     * for what changed.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @warning
+     * Attempting to use a component for which change ticks haven't been
+     * requested results in a compilation error (see change_ticks for more
+     * details).
+     *
+     * @tparam Comp Type of component of which to check the change ticks.
+     * @tparam Func Type of the function object to invoke.
+     * @param tick The tick from which to look for changes.
+     * @param func A valid function object.
+     */
+    template<typename Comp, typename Func>
+    inline void each_changed_since(const tick_type tick, Func func) {
+        const_cast<const PersistentView *>(this)->template each_changed_since<Comp>(tick, [&func](const entity_type entity, const Component &... component) {
+            func(entity, const_cast<Component &>(component)...);
+        });
+    }
+
     /**
      * @brief Sort the shared pool of entities according to the given component.
      *
@@ -431,7 +573,9 @@ private:
  * performance boost when iterate.<br/>
  * Order of elements during iterations are highly dependent on the order of the
  * underlying data structures. See SparseSet and its specializations for more
- * details.
+ * details.<br/>
+ * Entities that have at least one of the components excluded when the view was
+ * created (if any) are discarded during iterations.
  *
  * @b Important
  *
@@ -465,6 +609,11 @@ private:
 template<typename Entity, typename... Component>
 class View final {
     static_assert(sizeof...(Component) > 1, "!");
+    // objects stored in columns are accessed through raw views and owning groups
+    static_assert(std::is_same<
+        std::integer_sequence<bool, true, std::is_reference<typename SparseSet<Entity, Component>::reference_type>::value...>,
+        std::integer_sequence<bool, std::is_reference<typename SparseSet<Entity, Component>::reference_type>::value..., true>
+    >::value, "!");
 
     /*! @brief A registry is allowed to create views. */
     friend class Registry<Entity>;
@@ -478,6 +627,7 @@ class View final {
     using view_type = SparseSet<Entity>;
     using underlying_iterator_type = typename view_type::const_iterator_type;
     using unchecked_type = std::array<const view_type *, (sizeof...(Component) - 1)>;
+    using filter_type = std::vector<const view_type *>;
     using pattern_type = std::tuple<pool_type<Component> &...>;
     using traits_type = entt_traits<Entity>;
 
@@ -486,8 +636,9 @@ class View final {
 
         using extent_type = typename view_type::size_type;
 
-        Iterator(unchecked_type unchecked, underlying_iterator_type begin, underlying_iterator_type end) ENTT_NOEXCEPT
+        Iterator(unchecked_type unchecked, const filter_type *filter, underlying_iterator_type begin, underlying_iterator_type end) ENTT_NOEXCEPT
             : unchecked{unchecked},
+              filter{filter},
               begin{begin},
               end{end},
               extent{min(std::make_index_sequence<unchecked.size()>{})}
@@ -508,6 +659,9 @@ class View final {
 
             return sz < extent && std::all_of(unchecked.cbegin(), unchecked.cend(), [entity](const view_type *view) {
                 return view->fast(entity);
+            }) && std::none_of(filter->cbegin(), filter->cend(), [entity](const view_type *view) {
+                // the extent covers only the included pools, filters are checked with bounds
+                return view->has(entity);
             });
         }
 
@@ -550,13 +704,18 @@ class View final {
 
     private:
         unchecked_type unchecked;
+        const filter_type *filter;
         underlying_iterator_type begin;
         underlying_iterator_type end;
         extent_type extent;
     };
 
     View(pool_type<Component> &... pools) ENTT_NOEXCEPT
-        : pools{pools...}
+        : filter{}, pools{pools...}
+    {}
+
+    View(filter_type others, pool_type<Component> &... pools) ENTT_NOEXCEPT
+        : filter{std::move(others)}, pools{pools...}
     {}
 
     template<typename Comp>
@@ -579,6 +738,13 @@ class View final {
         return other;
     }
 
+    bool excluded(const Entity entity) const ENTT_NOEXCEPT {
+        // the extent covers only the included pools, filters are checked with bounds
+        return std::any_of(filter.cbegin(), filter.cend(), [entity](const view_type *view) {
+            return view->has(entity);
+        });
+    }
+
     template<typename Comp, typename Other>
     inline std::enable_if_t<std::is_same<Comp, Other>::value, const Other &>
     get(const component_iterator_type<Comp> &it, const Entity) const ENTT_NOEXCEPT { return *it; }
@@ -587,8 +753,16 @@ class View final {
     inline std::enable_if_t<!std::is_same<Comp, Other>::value, const Other &>
     get(const component_iterator_type<Comp> &, const Entity entity) const ENTT_NOEXCEPT { return pool<Other>().get(entity); }
 
-    template<typename Comp, typename Func, std::size_t... Indexes>
-    void each(const pool_type<Comp> &cpool, Func func, std::index_sequence<Indexes...>) const {
+    template<typename Func, typename Filter>
+    void each(Func func, Filter excluded) const {
+        const auto *view = candidate();
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (&pool<Component>() == view ? (each(pool<Component>(), std::move(func), std::move(excluded), std::make_index_sequence<sizeof...(Component)-1>{}), 0) : 0)... };
+        (void)accumulator;
+    }
+
+    template<typename Comp, typename Func, typename Filter, std::size_t... Indexes>
+    void each(const pool_type<Comp> &cpool, Func func, Filter excluded, std::index_sequence<Indexes...>) const {
         const auto other = unchecked(&cpool);
         std::array<underlying_iterator_type, sizeof...(Indexes)> data{{std::get<Indexes>(other)->cbegin()...}};
         const auto extent = std::min({ pool<Component>().extent()... });
@@ -598,7 +772,15 @@ class View final {
 
         // we can directly use the raw iterators if pools are ordered
         while(begin != end && std::min({ (*(std::get<Indexes>(data)++) == *begin)... })) {
-            func(*(begin++), *(std::get<component_iterator_type<Component>>(raw)++)...);
+            const auto entity = *(begin++);
+
+            if(excluded(entity)) {
+                using accumulator_type = int[];
+                accumulator_type accumulator = { (++std::get<component_iterator_type<Component>>(raw), 0)... };
+                (void)accumulator;
+            } else {
+                func(entity, *(std::get<component_iterator_type<Component>>(raw)++)...);
+            }
         }
 
         // fallback to visit what remains using indirections
@@ -607,7 +789,7 @@ class View final {
             const auto it = std::get<component_iterator_type<Comp>>(raw)++;
             const auto sz = size_type(entity & traits_type::entity_mask);
 
-            if(sz < extent && std::all_of(other.cbegin(), other.cend(), [entity](const view_type *view) { return view->fast(entity); })) {
+            if(sz < extent && std::all_of(other.cbegin(), other.cend(), [entity](const view_type *view) { return view->fast(entity); }) && !excluded(entity)) {
                 // avoided at least the indirection due to the sparse set for the pivot type (see get for more details)
                 func(entity, get<Comp, Component>(it, entity)...);
             }
@@ -619,6 +801,8 @@ public:
     using entity_type = typename view_type::entity_type;
     /*! @brief Unsigned integer type. */
     using size_type = typename view_type::size_type;
+    /*! @brief Unsigned integer type used for change ticks. */
+    using tick_type = typename view_type::tick_type;
     /*! @brief Input iterator type. */
     using iterator_type = Iterator;
     /*! @brief Constant input iterator type. */
@@ -656,7 +840,7 @@ public:
      */
     const_iterator_type cbegin() const ENTT_NOEXCEPT {
         const auto *view = candidate();
-        return const_iterator_type{unchecked(view), view->cbegin(), view->cend()};
+        return const_iterator_type{unchecked(view), &filter, view->cbegin(), view->cend()};
     }
 
     /**
@@ -712,7 +896,7 @@ public:
      */
     const_iterator_type cend() const ENTT_NOEXCEPT {
         const auto *view = candidate();
-        return const_iterator_type{unchecked(view), view->cend(), view->cend()};
+        return const_iterator_type{unchecked(view), &filter, view->cend(), view->cend()};
     }
 
     /**
@@ -761,7 +945,7 @@ public:
     bool contains(const entity_type entity) const ENTT_NOEXCEPT {
         const auto sz = size_type(entity & traits_type::entity_mask);
         const auto extent = std::min({ pool<Component>().extent()... });
-        return sz < extent && std::min({ (pool<Component>().has(entity) && (pool<Component>().data()[pool<Component>().view_type::get(entity)] == entity))... });
+        return sz < extent && std::min({ (pool<Component>().has(entity) && (pool<Component>().data()[pool<Component>().view_type::get(entity)] == entity))... }) && !excluded(entity);
     }
 
     /**
@@ -875,10 +1059,12 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        const auto *view = candidate();
-        using accumulator_type = int[];
-        accumulator_type accumulator = { (&pool<Component>() == view ? (each(pool<Component>(), std::move(func), std::make_index_sequence<sizeof...(Component)-1>{}), 0) : 0)... };
-        (void)accumulator;
+        if(filter.empty()) {
+            // no reason to pay for exclusion lists when there is nothing to filter out
+            each(std::move(func), [](const Entity) { return false; });
+        } else {
+            each(std::move(func), [this](const Entity entity) { return excluded(entity); });
+        }
     }
 
     /**
@@ -904,7 +1090,148 @@ public:
         });
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The smallest pool of candidates is split in chunks that are processed in
+     * parallel by the given executor. The function object is invoked for each
+     * entity. It is provided with the entity itself and a set of const
+     * references to all the components of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @sa JobSystem::parallel_for
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of entities per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    void parallel_each(Executor &executor, Func func, const size_type grain = {}) const {
+        const auto *view = candidate();
+        const auto other = unchecked(view);
+        const auto extent = std::min({ pool<Component>().extent()... });
+        const auto begin = view->cbegin();
+
+        executor.parallel_for(view->size(), grain, [&func, &other, extent, begin, this](const auto first, const auto last) {
+            std::for_each(begin + first, begin + last, [&func, &other, extent, this](const auto entity) {
+                const auto sz = size_type(entity & traits_type::entity_mask);
+
+                if(sz < extent && std::all_of(other.cbegin(), other.cend(), [entity](const view_type *curr) { return curr->fast(entity); }) && !excluded(entity)) {
+                    func(entity, pool<Component>().get(entity)...);
+                }
+            });
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * Non-const version of the function above, the function object is
+     * provided with references to the components instead.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @sa parallel_each
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of entities per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    inline void parallel_each(Executor &executor, Func func, const size_type grain = {}) {
+        const_cast<const View *>(this)->parallel_each(executor, [&func](const entity_type entity, const Component &... component) {
+            func(entity, const_cast<Component &>(component)...);
+        }, grain);
+    }
+
+    /**
+     * @brief Iterates entities and components that changed since a given tick
+     * and applies the given function object to them.
+     *
+     * The function object is invoked only for the entities whose component of
+     * the given type has been stamped with a tick greater than or equal to the
+     * one provided. The pool of the given component is walked in place of the
+     * smallest pool of candidates, therefore the function object is invoked only
+     * for what changed.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &...);
+     * @endcode
+     *
+     * @warning
+     * Attempting to use a component for which change ticks haven't been
+     * requested results in a compilation error (see change_ticks for more
+     * details).
+     *
+     * @tparam Comp Type of component of which to check the change ticks.
+     * @tparam Func Type of the function object to invoke.
+     * @param tick The tick from which to look for changes.
+     * @param func A valid function object.
+     */
+    template<typename Comp, typename Func>
+    void each_changed_since(const tick_type tick, Func func) const {
+        const auto &cpool = pool<Comp>();
+        const auto *ticks = cpool.ticks();
+        auto pos = cpool.size();
+
+        // ticks are laid out as the entities while iterators walk them backwards
+        std::for_each(cpool.view_type::cbegin(), cpool.view_type::cend(), [&](const auto entity) {
+            if(ticks[--pos] >= tick && contains(entity)) {
+                func(entity, pool<Component>().get(entity)...);
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components that changed since a given tick
+     * and applies the given function object to them.
+     *
+     * The function object is invoked only for the entities whose component of
+     * the given type has been stamped with a tick greater than or equal to the
+     * one provided. The pool of the given component is walked in place of the
+     * smallest pool of candidates, therefore the function object is invoked only
+     * for what changed.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * @endcode
+     *
+     * @warning
+     * Attempting to use a component for which change ticks haven't been
+     * requested results in a compilation error (see change_ticks for more
+     * details).
+     *
+     * @tparam Comp Type of component of which to check the change ticks.
+     * @tparam Func Type of the function object to invoke.
+     * @param tick The tick from which to look for changes.
+     * @param func A valid function object.
+     */
+    template<typename Comp, typename Func>
+    inline void each_changed_since(const tick_type tick, Func func) {
+        const_cast<const View *>(this)->template each_changed_since<Comp>(tick, [&func](const entity_type entity, const Component &... component) {
+            func(entity, const_cast<Component &>(component)...);
+        });
+    }
+
 private:
+    const filter_type filter;
     const pattern_type pools;
 };
 
@@ -949,6 +1276,8 @@ private:
  */
 template<typename Entity, typename Component>
 class View<Entity, Component> final {
+    // objects stored in columns are accessed through raw views and owning groups
+    static_assert(std::is_reference<typename SparseSet<Entity, Component>::reference_type>::value, "!");
     /*! @brief A registry is allowed to create views. */
     friend class Registry<Entity>;
 
@@ -966,6 +1295,8 @@ public:
     using entity_type = typename pool_type::entity_type;
     /*! @brief Unsigned integer type. */
     using size_type = typename pool_type::size_type;
+    /*! @brief Unsigned integer type used for change ticks. */
+    using tick_type = typename pool_type::tick_type;
     /*! @brief Input iterator type. */
     using iterator_type = typename view_type::iterator_type;
     /*! @brief Constant input iterator type. */
@@ -990,13 +1321,18 @@ public:
     /**
      * @brief Direct access to the list of components.
      *
-     * The returned pointer is such that range `[raw(), raw() + size()]` is
+     * When components are stored in a contiguous array (that is, the default),
+     * the returned pointer is such that range `[raw(), raw() + size()]` is
      * always a valid range, even if the container is empty.
      *
      * @note
      * There are no guarantees on the order of the components. Use `begin` and
      * `end` if you want to iterate the view in the expected order.
      *
+     * @warning
+     * Empty types, types stored in chunks and types stored in columns aren't
+     * laid out in a contiguous array (see `SparseSet::raw` for more details).
+     *
      * @return A pointer to the array of components.
      */
     const raw_type * raw() const ENTT_NOEXCEPT {
@@ -1006,13 +1342,18 @@ public:
     /**
      * @brief Direct access to the list of components.
      *
-     * The returned pointer is such that range `[raw(), raw() + size()]` is
+     * When components are stored in a contiguous array (that is, the default),
+     * the returned pointer is such that range `[raw(), raw() + size()]` is
      * always a valid range, even if the container is empty.
      *
      * @note
      * There are no guarantees on the order of the components. Use `begin` and
      * `end` if you want to iterate the view in the expected order.
      *
+     * @warning
+     * Empty types, types stored in chunks and types stored in columns aren't
+     * laid out in a contiguous array (see `SparseSet::raw` for more details).
+     *
      * @return A pointer to the array of components.
      */
     inline raw_type * raw() ENTT_NOEXCEPT {
@@ -1247,6 +1588,133 @@ public:
         });
     }
 
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * The pool of the component is split in chunks that are processed in
+     * parallel by the given executor. The function object is invoked for each
+     * entity. It is provided with the entity itself and a const reference to
+     * the component of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &);
+     * @endcode
+     *
+     * @sa JobSystem::parallel_for
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of entities per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    void parallel_each(Executor &executor, Func func, const size_type grain = {}) const {
+        const auto begin = pool.view_type::cbegin();
+        const auto raw = pool.cbegin();
+
+        executor.parallel_for(pool.size(), grain, [&func, begin, raw](const auto first, const auto last) {
+            std::for_each(begin + first, begin + last, [&func, curr = raw + first](const auto entity) mutable {
+                func(entity, *(curr++));
+            });
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components in parallel and applies the
+     * given function object to them.
+     *
+     * Non-const version of the function above, the function object is
+     * provided with a reference to the component instead.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &);
+     * @endcode
+     *
+     * @sa parallel_each
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of entities per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    inline void parallel_each(Executor &executor, Func func, const size_type grain = {}) {
+        const_cast<const View *>(this)->parallel_each(executor, [&func](const entity_type entity, const Component &component) {
+            func(entity, const_cast<Component &>(component));
+        }, grain);
+    }
+
+    /**
+     * @brief Iterates entities and components that changed since a given tick
+     * and applies the given function object to them.
+     *
+     * The function object is invoked only for the entities whose component has
+     * been stamped with a tick greater than or equal to the one provided.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, const Component &);
+     * @endcode
+     *
+     * @warning
+     * Attempting to use this function with a component for which change ticks
+     * haven't been requested results in a compilation error (see change_ticks
+     * for more details).
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param tick The tick from which to look for changes.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_changed_since(const tick_type tick, Func func) const {
+        const auto *ticks = pool.ticks();
+        auto pos = pool.size();
+
+        // ticks are laid out as the entities while iterators walk them backwards
+        std::for_each(pool.view_type::cbegin(), pool.view_type::cend(), [&func, &pos, ticks, tick, raw = pool.cbegin()](const auto entity) mutable {
+            if(ticks[--pos] >= tick) {
+                func(entity, *raw);
+            }
+
+            ++raw;
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components that changed since a given tick
+     * and applies the given function object to them.
+     *
+     * The function object is invoked only for the entities whose component has
+     * been stamped with a tick greater than or equal to the one provided.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &);
+     * @endcode
+     *
+     * @warning
+     * Attempting to use this function with a component for which change ticks
+     * haven't been requested results in a compilation error (see change_ticks
+     * for more details).
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param tick The tick from which to look for changes.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    inline void each_changed_since(const tick_type tick, Func func) {
+        const_cast<const View *>(this)->each_changed_since(tick, [&func](const entity_type entity, const Component &component) {
+            func(entity, const_cast<Component &>(component));
+        });
+    }
+
 private:
     pool_type &pool;
 };
@@ -1333,13 +1801,18 @@ public:
     /**
      * @brief Direct access to the list of components.
      *
-     * The returned pointer is such that range `[raw(), raw() + size()]` is
+     * When components are stored in a contiguous array (that is, the default),
+     * the returned pointer is such that range `[raw(), raw() + size()]` is
      * always a valid range, even if the container is empty.
      *
      * @note
      * There are no guarantees on the order of the components. Use `begin` and
      * `end` if you want to iterate the view in the expected order.
      *
+     * @warning
+     * Empty types, types stored in chunks and types stored in columns aren't
+     * laid out in a contiguous array (see `SparseSet::raw` for more details).
+     *
      * @return A pointer to the array of components.
      */
     const raw_type * raw() const ENTT_NOEXCEPT {
@@ -1349,13 +1822,18 @@ public:
     /**
      * @brief Direct access to the list of components.
      *
-     * The returned pointer is such that range `[raw(), raw() + size()]` is
+     * When components are stored in a contiguous array (that is, the default),
+     * the returned pointer is such that range `[raw(), raw() + size()]` is
      * always a valid range, even if the container is empty.
      *
      * @note
      * There are no guarantees on the order of the components. Use `begin` and
      * `end` if you want to iterate the view in the expected order.
      *
+     * @warning
+     * Empty types, types stored in chunks and types stored in columns aren't
+     * laid out in a contiguous array (see `SparseSet::raw` for more details).
+     *
      * @return A pointer to the array of components.
      */
     inline raw_type * raw() ENTT_NOEXCEPT {
@@ -1488,7 +1966,7 @@ public:
      * @param pos Position of the element to return.
      * @return A reference to the requested element.
      */
-    const raw_type & operator[](const size_type pos) const ENTT_NOEXCEPT {
+    typename pool_type::const_reference_type operator[](const size_type pos) const ENTT_NOEXCEPT {
         return pool[pos];
     }
 
@@ -1497,8 +1975,84 @@ public:
      * @param pos Position of the element to return.
      * @return A reference to the requested element.
      */
-    inline raw_type & operator[](const size_type pos) ENTT_NOEXCEPT {
-        return const_cast<raw_type &>(const_cast<const RawView *>(this)->operator[](pos));
+    inline typename pool_type::reference_type operator[](const size_type pos) ENTT_NOEXCEPT {
+        return pool[pos];
+    }
+
+    /**
+     * @brief Direct access to the column of a data member.
+     *
+     * The returned pointer is such that range `[column(member), column(member)
+     * + size()]` is always a valid range, even if the container is empty.<br/>
+     * Columns are in sync with each other and with the list of entities.
+     * Therefore, loops over columns can be vectorized by the compiler:
+     *
+     * @code{.cpp}
+     * auto view = registry.view<Position>(entt::raw_t{});
+     * auto *x = view.column(&Position::x);
+     *
+     * for(std::size_t pos = 0; pos < view.size(); ++pos) {
+     *     x[pos] += 1.f;
+     * }
+     * @endcode
+     *
+     * @note
+     * There are no guarantees on the order of the components. Use `data` to
+     * know to which entities they belong.
+     *
+     * @warning
+     * This function is available only for components stored in columns (see
+     * column_storage for more details).<br/>
+     * Attempting to get the column of a data member that isn't listed results
+     * in undefined behavior. An assertion will abort the execution at runtime
+     * in debug mode in this case.
+     *
+     * @tparam Field Type of the data member.
+     * @tparam Object Type of objects to which the data member belongs.
+     * @param member A pointer to a data member of the component.
+     * @return A pointer to the array of values of the data member.
+     */
+    template<typename Field, typename Object>
+    const Field * column(Field Object:: *member) const ENTT_NOEXCEPT {
+        return pool.column(member);
+    }
+
+    /**
+     * @brief Direct access to the column of a data member.
+     *
+     * The returned pointer is such that range `[column(member), column(member)
+     * + size()]` is always a valid range, even if the container is empty.<br/>
+     * Columns are in sync with each other and with the list of entities.
+     * Therefore, loops over columns can be vectorized by the compiler:
+     *
+     * @code{.cpp}
+     * auto view = registry.view<Position>(entt::raw_t{});
+     * auto *x = view.column(&Position::x);
+     *
+     * for(std::size_t pos = 0; pos < view.size(); ++pos) {
+     *     x[pos] += 1.f;
+     * }
+     * @endcode
+     *
+     * @note
+     * There are no guarantees on the order of the components. Use `data` to
+     * know to which entities they belong.
+     *
+     * @warning
+     * This function is available only for components stored in columns (see
+     * column_storage for more details).<br/>
+     * Attempting to get the column of a data member that isn't listed results
+     * in undefined behavior. An assertion will abort the execution at runtime
+     * in debug mode in this case.
+     *
+     * @tparam Field Type of the data member.
+     * @tparam Object Type of objects to which the data member belongs.
+     * @param member A pointer to a data member of the component.
+     * @return A pointer to the array of values of the data member.
+     */
+    template<typename Field, typename Object>
+    inline Field * column(Field Object:: *member) ENTT_NOEXCEPT {
+        return const_cast<Field *>(const_cast<const RawView *>(this)->column(member));
     }
 
     /**
@@ -1531,6 +2085,10 @@ public:
      * void(Component &);
      * @endcode
      *
+     * @note
+     * Components stored in columns are built on demand and the function object
+     * is provided with copies of them. Use `column` to update them instead.
+     *
      * @tparam Func Type of the function object to invoke.
      * @param func A valid function object.
      */
@@ -1539,6 +2097,67 @@ public:
         std::for_each(pool.begin(), pool.end(), func);
     }
 
+    /**
+     * @brief Iterates components in parallel and applies the given function
+     * object to them.
+     *
+     * The pool of the component is split in chunks that are processed in
+     * parallel by the given executor. The function object is provided with a
+     * const reference to each component of the view.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const Component &);
+     * @endcode
+     *
+     * @sa JobSystem::parallel_for
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of components per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    void parallel_each(Executor &executor, Func func, const size_type grain = {}) const {
+        const auto begin = pool.cbegin();
+
+        executor.parallel_for(pool.size(), grain, [&func, begin](const auto first, const auto last) {
+            std::for_each(begin + first, begin + last, [&func](auto &&component) { func(component); });
+        });
+    }
+
+    /**
+     * @brief Iterates components in parallel and applies the given function
+     * object to them.
+     *
+     * Non-const version of the function above, the function object is
+     * provided with references to the components instead.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(Component &);
+     * @endcode
+     *
+     * @sa parallel_each
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of components per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    void parallel_each(Executor &executor, Func func, const size_type grain = {}) {
+        const auto begin = pool.begin();
+
+        executor.parallel_for(pool.size(), grain, [&func, begin](const auto first, const auto last) {
+            std::for_each(begin + first, begin + last, [&func](auto &&component) { func(component); });
+        });
+    }
+
 private:
     pool_type &pool;
 };
@@ -1554,7 +2173,9 @@ private:
  * when iterate.<br/>
  * Order of elements during iterations are highly dependent on the order of the
  * underlying data structures. See SparseSet and its specializations for more
- * details.
+ * details.<br/>
+ * Entities that have at least one of the components excluded when the view was
+ * created (if any) are discarded during iterations.
  *
  * @b Important
  *
@@ -1600,11 +2221,12 @@ class RuntimeView {
     class Iterator {
         friend class RuntimeView<Entity>;
 
-        Iterator(underlying_iterator_type begin, underlying_iterator_type end, const view_type * const *first, const view_type * const *last, extent_type extent) ENTT_NOEXCEPT
+        Iterator(underlying_iterator_type begin, underlying_iterator_type end, const view_type * const *first, const view_type * const *last, const pattern_type *filter, extent_type extent) ENTT_NOEXCEPT
             : begin{begin},
               end{end},
               first{first},
               last{last},
+              filter{filter},
               extent{extent}
         {
             if(begin != end && !valid()) {
@@ -1618,6 +2240,9 @@ class RuntimeView {
 
             return sz < extent && std::all_of(first, last, [entity](const auto *view) {
                 return view->fast(entity);
+            }) && std::none_of(filter->cbegin(), filter->cend(), [entity](const auto *view) {
+                // the extent covers only the included pools, filters are checked with bounds
+                return view->has(entity);
             });
         }
 
@@ -1663,12 +2288,16 @@ class RuntimeView {
         underlying_iterator_type end;
         const view_type * const *first;
         const view_type * const *last;
+        const pattern_type *filter;
         extent_type extent;
     };
 
-    RuntimeView(pattern_type others) ENTT_NOEXCEPT
-        : pools{std::move(others)}
+    RuntimeView(pattern_type others, pattern_type excluded) ENTT_NOEXCEPT
+        : pools{std::move(others)}, filter{std::move(excluded)}
     {
+        // pools that don't exist yet can't exclude any entity
+        filter.erase(std::remove(filter.begin(), filter.end(), nullptr), filter.end());
+
         const auto it = std::min_element(pools.begin(), pools.end(), [](const auto *lhs, const auto *rhs) {
             return (!lhs && rhs) || (lhs && rhs && lhs->size() < rhs->size());
         });
@@ -1741,7 +2370,7 @@ public:
         if(valid()) {
             const auto &pool = *pools.front();
             const auto * const *data = pools.data();
-            it = { pool.cbegin(), pool.cend(), data + 1, data + pools.size(), min() };
+            it = { pool.cbegin(), pool.cend(), data + 1, data + pools.size(), &filter, min() };
         }
 
         return it;
@@ -1803,7 +2432,7 @@ public:
 
         if(valid()) {
             const auto &pool = *pools.front();
-            it = { pool.cend(), pool.cend(), nullptr, nullptr, min() };
+            it = { pool.cend(), pool.cend(), nullptr, nullptr, &filter, min() };
         }
 
         return it;
@@ -1855,6 +2484,8 @@ public:
     bool contains(const entity_type entity) const ENTT_NOEXCEPT {
         return valid() && std::all_of(pools.cbegin(), pools.cend(), [entity](const auto *view) {
             return view->has(entity) && view->data()[view->get(entity)] == entity;
+        }) && std::none_of(filter.cbegin(), filter.cend(), [entity](const auto *view) {
+            return view->has(entity) && view->data()[view->get(entity)] == entity;
         });
     }
 
@@ -1878,8 +2509,48 @@ public:
         std::for_each(cbegin(), cend(), func);
     }
 
+    /**
+     * @brief Iterates entities in parallel and applies the given function
+     * object to them.
+     *
+     * The smallest pool of candidates is split in chunks that are processed in
+     * parallel by the given executor. The function object is invoked for each
+     * entity. It is provided only with the entity itself. To get the
+     * components, users can use the registry with which the view was
+     * built.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @sa JobSystem::parallel_for
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of the function object to invoke.
+     * @param executor A valid executor.
+     * @param func A valid function object.
+     * @param grain Number of entities per chunk, zero to let the executor
+     * decide.
+     */
+    template<typename Executor, typename Func>
+    void parallel_each(Executor &executor, Func func, const size_type grain = {}) const {
+        if(valid()) {
+            const auto begin = pools.front()->cbegin();
+
+            executor.parallel_for(pools.front()->size(), grain, [&func, begin, this](const auto first, const auto last) {
+                std::for_each(begin + first, begin + last, [&func, this](const auto entity) {
+                    if(contains(entity)) {
+                        func(entity);
+                    }
+                });
+            });
+        }
+    }
+
 private:
     pattern_type pools;
+    pattern_type filter;
 };
 
 
@@ -2,18 +2,28 @@
 #include "core/family.hpp"
 #include "core/hashed_string.hpp"
 #include "core/ident.hpp"
+#include "core/memory.hpp"
 #include "core/monostate.hpp"
 #include "entity/actor.hpp"
+#include "entity/archive.hpp"
 #include "entity/attachee.hpp"
+#include "entity/command_buffer.hpp"
+#include "entity/delta_snapshot.hpp"
 #include "entity/entity.hpp"
 #include "entity/entt_traits.hpp"
+#include "entity/group.hpp"
 #include "entity/helper.hpp"
+#include "entity/mapped_snapshot.hpp"
+#include "entity/observer.hpp"
 #include "entity/prototype.hpp"
 #include "entity/registry.hpp"
+#include "entity/rollback.hpp"
 #include "entity/snapshot.hpp"
 #include "entity/sparse_set.hpp"
+#include "entity/system_graph.hpp"
 #include "entity/utility.hpp"
 #include "entity/view.hpp"
+#include "job/job_system.hpp"
 #include "locator/locator.hpp"
 #include "process/process.hpp"
 #include "process/scheduler.hpp"
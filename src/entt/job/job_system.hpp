@@ -0,0 +1,646 @@
+#ifndef ENTT_JOB_JOB_SYSTEM_HPP
+#define ENTT_JOB_JOB_SYSTEM_HPP
+
+
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <condition_variable>
+#include "../config/config.h"
+
+
+namespace entt {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Type>
+class WorkStealingDeque final {
+    static_assert(std::is_pointer<Type>::value, "!");
+
+    struct Array final {
+        explicit Array(const std::int64_t capacity)
+            : mask{capacity - 1}, elements{new std::atomic<Type>[capacity]}
+        {}
+
+        std::int64_t capacity() const ENTT_NOEXCEPT {
+            return mask + 1;
+        }
+
+        Type get(const std::int64_t pos) const ENTT_NOEXCEPT {
+            return elements[pos & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(const std::int64_t pos, const Type value) ENTT_NOEXCEPT {
+            elements[pos & mask].store(value, std::memory_order_relaxed);
+        }
+
+        const std::int64_t mask;
+        std::unique_ptr<std::atomic<Type>[]> elements;
+    };
+
+public:
+    explicit WorkStealingDeque(const std::int64_t capacity = 256)
+        : top{}, bottom{}, array{new Array{capacity}}
+    {
+        arrays.emplace_back(array.load(std::memory_order_relaxed));
+    }
+
+    // only the owner of the deque can push elements
+    void push(const Type value) {
+        const auto last = bottom.load(std::memory_order_relaxed);
+        const auto first = top.load(std::memory_order_acquire);
+        auto *curr = array.load(std::memory_order_relaxed);
+
+        if(last - first > curr->capacity() - 1) {
+            // thieves can still read from the old arrays, they are released along with the deque
+            auto *next = new Array{curr->capacity() * 2};
+
+            for(auto pos = first; pos < last; ++pos) {
+                next->put(pos, curr->get(pos));
+            }
+
+            arrays.emplace_back(next);
+            array.store(next, std::memory_order_release);
+            curr = next;
+        }
+
+        curr->put(last, value);
+        bottom.store(last + 1, std::memory_order_release);
+    }
+
+    // only the owner of the deque can pop elements
+    Type pop() ENTT_NOEXCEPT {
+        const auto last = bottom.load(std::memory_order_relaxed) - 1;
+        auto *curr = array.load(std::memory_order_relaxed);
+        bottom.store(last, std::memory_order_seq_cst);
+        auto first = top.load(std::memory_order_seq_cst);
+        Type value = nullptr;
+
+        if(first <= last) {
+            value = curr->get(last);
+
+            if(first == last) {
+                // last element, it's contended by thieves
+                if(!top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    value = nullptr;
+                }
+
+                bottom.store(last + 1, std::memory_order_relaxed);
+            }
+        } else {
+            bottom.store(last + 1, std::memory_order_relaxed);
+        }
+
+        return value;
+    }
+
+    // any thread can steal elements
+    Type steal() ENTT_NOEXCEPT {
+        auto first = top.load(std::memory_order_seq_cst);
+        const auto last = bottom.load(std::memory_order_seq_cst);
+        Type value = nullptr;
+
+        if(first < last) {
+            value = array.load(std::memory_order_acquire)->get(first);
+
+            if(!top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                value = nullptr;
+            }
+        }
+
+        return value;
+    }
+
+private:
+    std::atomic<std::int64_t> top;
+    char padding[ENTT_CACHE_LINE_SIZE];
+    std::atomic<std::int64_t> bottom;
+    std::atomic<Array *> array;
+    std::vector<std::unique_ptr<Array>> arrays;
+};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Work-stealing job system.
+ *
+ * A job system owns a bunch of worker threads, each one with its own deque of
+ * jobs. Workers push and pop jobs at the back of their deques and steal them
+ * from the front of the deques of the others when they run out of work.<br/>
+ * Threads that submit work to a job system take part in it until their work is
+ * done, therefore a job system created for `N` threads spawns only `N - 1`
+ * workers.
+ *
+ * Example of use:
+ *
+ * @code{.cpp}
+ * entt::JobSystem jobs{};
+ *
+ * jobs.parallel_for(data.size(), 0, [&data](auto first, auto last) {
+ *     // ...
+ * });
+ *
+ * const auto physics = jobs.spawn([]() { ... });
+ * const auto render = jobs.then(physics, []() { ... });
+ * jobs.wait(render);
+ * @endcode
+ *
+ * Jobs can depend on other jobs. A job runs only when all its dependencies
+ * have been executed and it can spawn other jobs in turn.<br/>
+ * Job systems are also executors for views, groups, schedulers and
+ * dispatchers. See their `parallel_each` and `parallel_update` member
+ * functions for more details.
+ *
+ * @note
+ * Function objects are invoked concurrently from different threads. It's up to
+ * the users to make them thread-safe.
+ *
+ * @warning
+ * Function objects must not throw. Exceptions thrown by a worker terminate the
+ * application.
+ */
+class JobSystem final {
+    struct Job final {
+        void(*function)(JobSystem &, Job &);
+        void *data;
+        std::size_t first;
+        std::size_t last;
+    };
+
+    struct Context final {
+        const JobSystem *owner;
+        std::size_t index;
+        std::uint32_t seed;
+    };
+
+    struct Task {
+        virtual ~Task() = default;
+        virtual void run() = 0;
+
+        Job job;
+        std::shared_ptr<Task> self;
+        std::atomic<std::size_t> pending;
+        std::atomic<bool> finished;
+        std::vector<std::shared_ptr<Task>> continuations;
+        std::mutex mutex;
+    };
+
+    template<typename Func>
+    struct Callable final: Task {
+        Callable(Func func)
+            : func{std::move(func)}
+        {}
+
+        void run() override {
+            func();
+        }
+
+        Func func;
+    };
+
+    template<typename Func>
+    struct Loop final {
+        Func *func;
+        std::size_t count;
+        std::size_t grain;
+        std::unique_ptr<Job[]> jobs;
+        std::atomic<std::size_t> next;
+        std::atomic<std::size_t> remaining;
+    };
+
+    using deque_type = internal::WorkStealingDeque<Job *>;
+
+    static Context & context() ENTT_NOEXCEPT {
+        static thread_local Context ctx{nullptr, 0u, 0u};
+        return ctx;
+    }
+
+    template<typename Func>
+    static void loop(JobSystem &system, Job &job) {
+        auto &ctx = *static_cast<Loop<Func> *>(job.data);
+        auto first = job.first;
+        auto last = job.last;
+
+        // halves are left behind for the thieves, larger ranges are stolen first
+        while(last - first > 1) {
+            const auto middle = first + (last - first) / 2;
+            auto &other = ctx.jobs[ctx.next.fetch_add(1, std::memory_order_relaxed)];
+            other = Job{&loop<Func>, &ctx, middle, last};
+            system.push(&other);
+            last = middle;
+        }
+
+        const auto begin = first * ctx.grain;
+        (*ctx.func)(begin, std::min(begin + ctx.grain, ctx.count));
+        ctx.remaining.fetch_sub(1, std::memory_order_release);
+    }
+
+    static void execute(JobSystem &system, Job &job) {
+        auto &task = *static_cast<Task *>(job.data);
+        // the job system doesn't own the task anymore, it dies along with the last handle
+        const auto keep = std::move(task.self);
+        decltype(task.continuations) next;
+
+        task.run();
+
+        {
+            std::lock_guard<std::mutex> guard{task.mutex};
+            task.finished.store(true, std::memory_order_release);
+            next.swap(task.continuations);
+        }
+
+        for(auto &&other: next) {
+            system.release(*other);
+        }
+
+        system.active.fetch_sub(1, std::memory_order_release);
+    }
+
+    void release(Task &task) {
+        if(task.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            push(&task.job);
+        }
+    }
+
+    template<typename Func>
+    void enter(Func func) {
+        if(context().owner == this) {
+            func();
+        } else {
+            // external threads share the first deque, one at a time
+            std::lock_guard<std::mutex> guard{external};
+            const auto prev = std::exchange(context(), Context{this, 0u, 2654435761u});
+            func();
+            context() = prev;
+        }
+    }
+
+    void help() {
+        if(auto *job = take()) {
+            job->function(*this, *job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    void push(Job *job) {
+        deques[context().index].push(job);
+        queued.fetch_add(1);
+
+        if(sleeping.load()) {
+            // the lock prevents wake up calls from getting lost
+            { std::lock_guard<std::mutex> guard{mutex}; }
+            available.notify_one();
+        }
+    }
+
+    Job * take() {
+        auto &ctx = context();
+        Job *job = deques[ctx.index].pop();
+
+        for(std::size_t attempt{}, last = concurrency(); !job && attempt < last; ++attempt) {
+            // xorshift, victims are picked at random to spread contention
+            ctx.seed ^= ctx.seed << 13;
+            ctx.seed ^= ctx.seed >> 17;
+            ctx.seed ^= ctx.seed << 5;
+
+            const auto victim = ctx.seed % last;
+
+            if(victim != ctx.index) {
+                job = deques[victim].steal();
+            }
+        }
+
+        if(job) {
+            queued.fetch_sub(1);
+        }
+
+        return job;
+    }
+
+    void work(const std::size_t index) {
+        context() = Context{this, index, static_cast<std::uint32_t>(index * 2654435761u) | 1u};
+
+        while(running.load()) {
+            if(auto *job = take()) {
+                job->function(*this, *job);
+            } else {
+                std::unique_lock<std::mutex> lock{mutex};
+                sleeping.fetch_add(1);
+                // timed waits, idle workers look around every now and then anyway
+                available.wait_for(lock, std::chrono::milliseconds{10}, [this]() { return !running.load() || queued.load(); });
+                sleeping.fetch_sub(1);
+            }
+        }
+    }
+
+    template<typename Func>
+    void run(Loop<Func> &ctx) {
+        ctx.next.store(1u, std::memory_order_relaxed);
+        ctx.jobs[0] = Job{&loop<Func>, &ctx, 0u, ctx.remaining.load(std::memory_order_relaxed)};
+        push(&ctx.jobs[0]);
+
+        // the calling thread runs jobs while it waits for the loop to end
+        while(ctx.remaining.load(std::memory_order_acquire)) {
+            help();
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Opaque handle to a job.
+     *
+     * Handles are cheap to copy and keep alive the jobs they refer to. They
+     * are used to wait for jobs and to declare dependencies between them.
+     */
+    class Handle final {
+        friend class JobSystem;
+
+        Handle(std::shared_ptr<Task> task)
+            : task{std::move(task)}
+        {}
+
+    public:
+        /*! @brief Default constructor, the handle refers to no job. */
+        Handle() ENTT_NOEXCEPT = default;
+
+        /**
+         * @brief Checks if the job has been executed.
+         * @return True if the job has been executed or the handle refers to
+         * no job, false otherwise.
+         */
+        bool done() const ENTT_NOEXCEPT {
+            return !task || task->finished.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Checks if a handle refers to a job.
+         * @return True if the handle refers to a job, false otherwise.
+         */
+        explicit operator bool() const ENTT_NOEXCEPT {
+            return static_cast<bool>(task);
+        }
+
+    private:
+        std::shared_ptr<Task> task;
+    };
+
+    /**
+     * @brief Constructs a job system for the given number of threads.
+     *
+     * The calling thread counts as one of them, therefore only
+     * `concurrency - 1` workers are spawned.
+     *
+     * @param concurrency Number of threads that take part in the work.
+     */
+    explicit JobSystem(const size_type concurrency = std::max(1u, std::thread::hardware_concurrency()))
+        : deques{new deque_type[std::max(concurrency, size_type{1})]},
+          size{std::max(concurrency, size_type{1})},
+          queued{},
+          sleeping{},
+          active{},
+          running{true}
+    {
+        // the first deque is reserved to the threads that submit work
+        for(size_type pos = 1; pos < size; ++pos) {
+            workers.emplace_back(&JobSystem::work, this, pos);
+        }
+    }
+
+    /*! @brief Waits for the pending jobs, then stops and joins the workers. */
+    ~JobSystem() {
+        enter([this]() {
+            while(active.load(std::memory_order_acquire)) {
+                help();
+            }
+        });
+
+        {
+            std::lock_guard<std::mutex> guard{mutex};
+            running.store(false);
+        }
+
+        available.notify_all();
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+    }
+
+    /*! @brief Copying a job system isn't allowed. */
+    JobSystem(const JobSystem &) = delete;
+    /*! @brief Moving a job system isn't allowed. */
+    JobSystem(JobSystem &&) = delete;
+
+    /*! @brief Copying a job system isn't allowed. @return This job system. */
+    JobSystem & operator=(const JobSystem &) = delete;
+    /*! @brief Moving a job system isn't allowed. @return This job system. */
+    JobSystem & operator=(JobSystem &&) = delete;
+
+    /**
+     * @brief Returns the number of threads that take part in the work.
+     * @return Number of threads that take part in the work.
+     */
+    size_type concurrency() const ENTT_NOEXCEPT {
+        return size;
+    }
+
+    /**
+     * @brief Returns the index of the calling thread within the job system.
+     *
+     * Indexes are in the range `[0, concurrency())` for the threads that are
+     * running jobs, `concurrency()` for all the others. Therefore they can be
+     * used to pick per-thread data, such as command buffers, from within jobs
+     * and parallel iterations.
+     *
+     * @return The index of the calling thread within the job system.
+     */
+    size_type worker() const ENTT_NOEXCEPT {
+        const auto &ctx = context();
+        return ctx.owner == this ? ctx.index : size;
+    }
+
+    /**
+     * @brief Splits a range of indexes in chunks and processes them in
+     * parallel.
+     *
+     * The range `[0, count)` is split in chunks of `grain` indexes each, the
+     * last one excepted. The function object is invoked once per chunk and
+     * the calling thread takes part in the work until all the chunks have been
+     * processed.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(size_type first, size_type last);
+     * @endcode
+     *
+     * When `grain` is zero, the size of the chunks is chosen according to the
+     * number of threads. Otherwise chunking is deterministic: the boundaries of
+     * the chunks depend neither on the number of threads nor on the thread
+     * that processes them.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param count Number of indexes to process.
+     * @param grain Number of indexes per chunk, zero to let the job system
+     * decide.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void parallel_for(const size_type count, const size_type grain, Func func) {
+        const auto chunk = grain ? grain : std::max(count / (size * 8u), size_type{1});
+        const auto chunks = (count + chunk - 1) / chunk;
+
+        if(chunks < 2 || size == 1) {
+            enter([&func, count, chunk, chunks]() {
+                for(size_type pos{}; pos < chunks; ++pos) {
+                    func(pos * chunk, std::min(pos * chunk + chunk, count));
+                }
+            });
+        } else {
+            Loop<Func> ctx{&func, count, chunk, std::unique_ptr<Job[]>{new Job[chunks]}, {}, {chunks}};
+            enter([this, &ctx]() { run(ctx); });
+        }
+    }
+
+    /**
+     * @brief Spawns a job that runs once all the given jobs have been
+     * executed.
+     *
+     * The job is executed as soon as its dependencies are satisfied, that is
+     * immediately if the range is empty or all the jobs in it are done.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void();
+     * @endcode
+     *
+     * @tparam It Type of input iterator, it must refer to handles.
+     * @tparam Func Type of the function object to invoke.
+     * @param first An iterator to the first handle of the range.
+     * @param last An iterator past the last handle of the range.
+     * @param func A valid function object.
+     * @return A handle to the job.
+     */
+    template<typename It, typename Func>
+    Handle spawn(It first, It last, Func func) {
+        auto task = std::make_shared<Callable<Func>>(std::move(func));
+        task->job = Job{&execute, static_cast<Task *>(task.get()), 0u, 0u};
+        task->self = task;
+        // an extra dependency prevents the job from running before it's fully set up
+        task->pending.store(1u, std::memory_order_relaxed);
+        task->finished.store(false, std::memory_order_relaxed);
+        active.fetch_add(1, std::memory_order_relaxed);
+
+        for(; first != last; ++first) {
+            if(auto *other = first->task.get()) {
+                std::lock_guard<std::mutex> guard{other->mutex};
+
+                if(!other->finished.load(std::memory_order_relaxed)) {
+                    task->pending.fetch_add(1, std::memory_order_relaxed);
+                    other->continuations.push_back(task);
+                }
+            }
+        }
+
+        enter([this, &task]() { release(*task); });
+        return Handle{std::move(task)};
+    }
+
+    /**
+     * @brief Spawns a job that runs as soon as possible.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void();
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     * @return A handle to the job.
+     */
+    template<typename Func>
+    Handle spawn(Func func) {
+        return spawn(static_cast<const Handle *>(nullptr), static_cast<const Handle *>(nullptr), std::move(func));
+    }
+
+    /**
+     * @brief Spawns a continuation for the given job.
+     *
+     * The continuation runs once the given job has been executed. If the
+     * handle refers to no job or the job is already done, the continuation
+     * runs as soon as possible.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param handle A handle to a job.
+     * @param func A valid function object.
+     * @return A handle to the continuation.
+     */
+    template<typename Func>
+    Handle then(const Handle &handle, Func func) {
+        return spawn(&handle, &handle + 1, std::move(func));
+    }
+
+    /**
+     * @brief Waits for a job to be executed.
+     *
+     * The calling thread takes part in the work until the job is done, it
+     * doesn't just sleep.
+     *
+     * @param handle A handle to a job.
+     */
+    void wait(const Handle &handle) {
+        if(!handle.done()) {
+            enter([this, &handle]() {
+                while(!handle.done()) {
+                    help();
+                }
+            });
+        }
+    }
+
+private:
+    std::unique_ptr<deque_type[]> deques;
+    const size_type size;
+    std::vector<std::thread> workers;
+    std::atomic<size_type> queued;
+    std::atomic<size_type> sleeping;
+    std::atomic<size_type> active;
+    std::atomic<bool> running;
+    std::condition_variable available;
+    std::mutex mutex;
+    std::mutex external;
+};
+
+
+}
+
+
+#endif // ENTT_JOB_JOB_SYSTEM_HPP
@@ -2,6 +2,7 @@
 #define ENTT_PROCESS_SCHEDULER_HPP
 
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <utility>
@@ -278,6 +279,54 @@ public:
         }
     }
 
+    /**
+     * @brief Updates all scheduled processes in parallel.
+     *
+     * Processes are handed to the given executor and updated concurrently,
+     * each process and its children on a single thread at a time.<br/>
+     * The executor must expose a member function equivalent to the following:
+     *
+     * @code{.cpp}
+     * template<typename Func>
+     * void parallel_for(size_type count, size_type grain, Func func);
+     * @endcode
+     *
+     * Where `func` is invoked as `func(first, last)` once per chunk of the
+     * range `[0, count)` and the function returns only when all the chunks
+     * have been processed.
+     *
+     * @warning
+     * Processes must be thread-safe with respect to each other and to the
+     * optional data.
+     *
+     * @sa update
+     *
+     * @tparam Executor Type of executor to use.
+     * @param executor A valid executor.
+     * @param delta Elapsed time.
+     * @param data Optional data.
+     */
+    template<typename Executor>
+    void parallel_update(Executor &executor, const Delta delta, void *data = nullptr) {
+        std::atomic<bool> clean{false};
+
+        executor.parallel_for(handlers.size(), size_type{1}, [this, &clean, delta, data](const auto first, const auto last) {
+            for(auto pos = first; pos < last; ++pos) {
+                auto &handler = handlers[pos];
+
+                if(handler.update(handler, delta, data)) {
+                    clean.store(true, std::memory_order_relaxed);
+                }
+            }
+        });
+
+        if(clean.load(std::memory_order_relaxed)) {
+            handlers.erase(std::remove_if(handlers.begin(), handlers.end(), [](auto &handler) {
+                return !handler.instance;
+            }), handlers.end());
+        }
+    }
+
     /**
      * @brief Aborts all scheduled processes.
      *
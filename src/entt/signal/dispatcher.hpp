@@ -5,11 +5,13 @@
 #include <vector>
 #include <memory>
 #include <utility>
+#include <cstddef>
 #include <cstdint>
 #include <algorithm>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/family.hpp"
+#include "../core/memory.hpp"
 #include "sigh.hpp"
 
 
@@ -46,6 +48,11 @@ class Dispatcher final {
     template<typename Event>
     struct SignalWrapper final: BaseSignalWrapper {
         using sink_type = typename SigH<void(const Event &)>::sink_type;
+        using container_type = std::vector<Event, Allocator<Event>>;
+
+        SignalWrapper(MemoryResource *resource)
+            : events{container_type(resource), container_type(resource)}
+        {}
 
         void publish() override {
             const auto &curr = current++;
@@ -70,7 +77,7 @@ class Dispatcher final {
 
     private:
         SigH<void(const Event &)> signal{};
-        std::vector<Event> events[2];
+        container_type events[2];
         int current{};
     };
 
@@ -83,7 +90,7 @@ class Dispatcher final {
         }
 
         if(!wrappers[type]) {
-            wrappers[type] = std::make_unique<SignalWrapper<Event>>();
+            wrappers[type] = allocate_unique<BaseSignalWrapper, SignalWrapper<Event>>(wrappers.get_allocator().resource(), wrappers.get_allocator().resource());
         }
 
         return static_cast<SignalWrapper<Event> &>(*wrappers[type]);
@@ -94,6 +101,25 @@ public:
     template<typename Event>
     using sink_type = typename SignalWrapper<Event>::sink_type;
 
+    /*! @brief Default constructor. */
+    Dispatcher() = default;
+
+    /**
+     * @brief Constructs a dispatcher that gets memory from the given resource.
+     *
+     * Queues of events and the other internal data structures get their
+     * memory from the given resource.
+     *
+     * @warning
+     * The resource must outlive the dispatcher. Otherwise, attempting to use
+     * the dispatcher results in undefined behavior.
+     *
+     * @param resource A memory resource, if any.
+     */
+    explicit Dispatcher(MemoryResource *resource)
+        : wrappers(resource)
+    {}
+
     /**
      * @brief Returns a sink object for the given event.
      *
@@ -177,8 +203,46 @@ public:
         }
     }
 
+    /**
+     * @brief Delivers all the pending events in parallel.
+     *
+     * Queues of events are handed to the given executor and delivered
+     * concurrently, each queue on a single thread. Events of the same type
+     * are still delivered in order.<br/>
+     * The executor must expose a member function equivalent to the following:
+     *
+     * @code{.cpp}
+     * template<typename Func>
+     * void parallel_for(std::size_t count, std::size_t grain, Func func);
+     * @endcode
+     *
+     * Where `func` is invoked as `func(first, last)` once per chunk of the
+     * range `[0, count)` and the function returns only when all the chunks
+     * have been processed.
+     *
+     * @warning
+     * Listeners for different types of events are invoked concurrently. They
+     * must be thread-safe with respect to each other and they must neither
+     * trigger nor enqueue events through this dispatcher.
+     *
+     * @tparam Executor Type of executor to use.
+     * @param executor A valid executor.
+     */
+    template<typename Executor>
+    void parallel_update(Executor &executor) const {
+        executor.parallel_for(wrappers.size(), std::size_t{1}, [this](const auto first, const auto last) {
+            for(auto pos = first; pos < last; ++pos) {
+                auto &wrapper = wrappers[pos];
+
+                if(wrapper) {
+                    wrapper->publish();
+                }
+            }
+        });
+    }
+
 private:
-    std::vector<std::unique_ptr<BaseSignalWrapper>> wrappers;
+    std::vector<std::unique_ptr<BaseSignalWrapper, Deleter<BaseSignalWrapper>>, Allocator<std::unique_ptr<BaseSignalWrapper, Deleter<BaseSignalWrapper>>>> wrappers;
 };
 
 
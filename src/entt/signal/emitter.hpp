@@ -12,6 +12,7 @@
 #include <list>
 #include "../config/config.h"
 #include "../core/family.hpp"
+#include "../core/memory.hpp"
 
 
 namespace entt {
@@ -52,9 +53,13 @@ class Emitter {
     struct Handler final: BaseHandler {
         using listener_type = std::function<void(const Event &, Derived &)>;
         using element_type = std::pair<bool, listener_type>;
-        using container_type = std::list<element_type>;
+        using container_type = std::list<element_type, Allocator<element_type>>;
         using connection_type = typename container_type::iterator;
 
+        Handler(MemoryResource *resource)
+            : onceL(resource), onL(resource)
+        {}
+
         bool empty() const ENTT_NOEXCEPT override {
             auto pred = [](auto &&element) { return element.first; };
 
@@ -92,7 +97,7 @@ class Emitter {
         }
 
         void publish(const Event &event, Derived &ref) {
-            container_type currentL;
+            container_type currentL(onceL.get_allocator());
             onceL.swap(currentL);
 
             auto func = [&event, &ref](auto &&element) {
@@ -111,8 +116,8 @@ class Emitter {
 
     private:
         bool publishing{false};
-        container_type onceL{};
-        container_type onL{};
+        container_type onceL;
+        container_type onL;
     };
 
     template<typename Event>
@@ -124,7 +129,7 @@ class Emitter {
         }
 
         if(!handlers[family]) {
-            handlers[family] = std::make_unique<Handler<Event>>();
+            handlers[family] = allocate_unique<BaseHandler, Handler<Event>>(handlers.get_allocator().resource(), handlers.get_allocator().resource());
         }
 
         return static_cast<Handler<Event> &>(*handlers[family]);
@@ -181,6 +186,22 @@ public:
     /*! @brief Default constructor. */
     Emitter() ENTT_NOEXCEPT = default;
 
+    /**
+     * @brief Constructs an emitter that gets memory from the given resource.
+     *
+     * Handlers and lists of listeners get their memory from the given
+     * resource.
+     *
+     * @warning
+     * The resource must outlive the emitter. Otherwise, attempting to use the
+     * emitter results in undefined behavior.
+     *
+     * @param resource A memory resource, if any.
+     */
+    explicit Emitter(MemoryResource *resource) ENTT_NOEXCEPT
+        : handlers(resource)
+    {}
+
     /*! @brief Default destructor. */
     virtual ~Emitter() ENTT_NOEXCEPT {
         static_assert(std::is_base_of<Emitter<Derived>, Derived>::value, "!");
@@ -326,7 +347,7 @@ public:
     }
 
 private:
-    std::vector<std::unique_ptr<BaseHandler>> handlers{};
+    std::vector<std::unique_ptr<BaseHandler, Deleter<BaseHandler>>, Allocator<std::unique_ptr<BaseHandler, Deleter<BaseHandler>>>> handlers{};
 };
 
 
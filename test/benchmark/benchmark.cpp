@@ -1,10 +1,23 @@
 #include <iostream>
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <iterator>
+#include <sstream>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/entity/archive.hpp>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/delta_snapshot.hpp>
+#include <entt/entity/mapped_snapshot.hpp>
 #include <entt/entity/registry.hpp>
+#include <entt/entity/rollback.hpp>
+#include <entt/job/job_system.hpp>
 
 struct Position {
     std::uint64_t x;
@@ -19,6 +32,42 @@ struct Velocity {
 template<std::size_t>
 struct Comp { int x; };
 
+template<bool>
+struct Large { char data[2048]; };
+
+template<bool>
+struct Point { float x; float y; float z; };
+
+template<bool>
+struct Motion { float x; float y; float z; };
+
+struct Tracked {
+    std::uint64_t x;
+    std::uint64_t y;
+};
+
+namespace entt {
+    template<>
+    struct stable_storage<Large<true>>: std::true_type {};
+
+    template<>
+    struct change_ticks<Tracked>: std::true_type {};
+
+    template<>
+    struct column_storage<Point<true>>: std::true_type {
+        static constexpr auto members() {
+            return std::make_tuple(&Point<true>::x, &Point<true>::y, &Point<true>::z);
+        }
+    };
+
+    template<>
+    struct column_storage<Motion<true>>: std::true_type {
+        static constexpr auto members() {
+            return std::make_tuple(&Motion<true>::x, &Motion<true>::y, &Motion<true>::z);
+        }
+    };
+}
+
 struct Timer final {
     Timer(): start{std::chrono::system_clock::now()} {}
 
@@ -31,6 +80,28 @@ private:
     std::chrono::time_point<std::chrono::system_clock> start;
 };
 
+struct CountingResource: entt::MemoryResource {
+    void * allocate(const std::size_t size, const std::size_t) override {
+        ++allocations;
+        return ::operator new(size);
+    }
+
+    void deallocate(void *ptr, const std::size_t, const std::size_t) override {
+        ::operator delete(ptr);
+    }
+
+    std::size_t allocations{};
+};
+
+void populate(entt::DefaultRegistry &registry) {
+    for(std::uint64_t i = 0; i < 100000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+        registry.assign<Comp<0>>(entity);
+    }
+}
+
 TEST(Benchmark, Construct) {
     entt::DefaultRegistry registry;
 
@@ -45,6 +116,43 @@ TEST(Benchmark, Construct) {
     timer.elapsed();
 }
 
+TEST(Benchmark, ConstructMany) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Constructing 1000000 entities at once" << std::endl;
+
+    Timer timer;
+    registry.create(entities.begin(), entities.end());
+    timer.elapsed();
+}
+
+TEST(Benchmark, ConstructAndAssign) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Constructing 1000000 entities and assigning them a component" << std::endl;
+
+    Timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        registry.assign<Position>(registry.create());
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, ConstructManyAndAssign) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Constructing 1000000 entities at once and assigning them a component" << std::endl;
+
+    Timer timer;
+    registry.create(entities.begin(), entities.end());
+    registry.assign<Position>(entities.begin(), entities.end());
+    timer.elapsed();
+}
+
 TEST(Benchmark, Destroy) {
     entt::DefaultRegistry registry;
 
@@ -63,6 +171,154 @@ TEST(Benchmark, Destroy) {
     timer.elapsed();
 }
 
+TEST(Benchmark, DestroyMany) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Destroying 1000000 entities at once" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+
+    Timer timer;
+    registry.destroy(entities.begin(), entities.end());
+    timer.elapsed();
+}
+
+TEST(Benchmark, DestroyWithComponents) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Destroying 1000000 entities with components" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.assign<Position>(entities.begin(), entities.end());
+    registry.assign<Velocity>(entities.begin(), entities.end());
+
+    Timer timer;
+
+    for(const auto entity: entities) {
+        registry.destroy(entity);
+    }
+
+    timer.elapsed();
+}
+
+template<std::size_t... Index>
+void reserveMany(entt::DefaultRegistry &registry, std::index_sequence<Index...>) {
+    using accumulator_type = int[];
+    accumulator_type accumulator = { (registry.reserve<Comp<Index>>(0), 0)... };
+    (void)accumulator;
+}
+
+TEST(Benchmark, DestroyWithManyComponentTypes) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Destroying 1000000 entities with components, 128 types of components" << std::endl;
+
+    reserveMany(registry, std::make_index_sequence<128>{});
+    registry.create(entities.begin(), entities.end());
+    registry.assign<Position>(entities.begin(), entities.end());
+    registry.assign<Velocity>(entities.begin(), entities.end());
+
+    Timer timer;
+
+    for(const auto entity: entities) {
+        registry.destroy(entity);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, DestroyManyWithComponents) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+
+    std::cout << "Destroying 1000000 entities with components at once" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.assign<Position>(entities.begin(), entities.end());
+    registry.assign<Velocity>(entities.begin(), entities.end());
+
+    Timer timer;
+    registry.destroy(entities.begin(), entities.end());
+    timer.elapsed();
+}
+
+TEST(Benchmark, ReplaceLargeComponent) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(100000);
+
+    std::cout << "Replacing 100000 large components" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.assign<Large<false>>(entities.begin(), entities.end());
+
+    Timer timer;
+
+    for(const auto entity: entities) {
+        registry.replace<Large<false>>(entity);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, PatchLargeComponent) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(100000);
+
+    std::cout << "Patching 100000 large components" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.assign<Large<false>>(entities.begin(), entities.end());
+
+    Timer timer;
+
+    for(const auto entity: entities) {
+        registry.patch<Large<false>>(entity, [](auto &large) { large.data[0] = 'a'; });
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, DestroyHalfWithComponents) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+    std::vector<entt::DefaultRegistry::entity_type> half;
+
+    std::cout << "Destroying 500000 scattered entities with components" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.assign<Position>(entities.begin(), entities.end());
+    registry.assign<Velocity>(entities.begin(), entities.end());
+    std::copy_if(entities.cbegin(), entities.cend(), std::back_inserter(half), [](const auto entity) { return entity % 2; });
+
+    Timer timer;
+
+    for(const auto entity: half) {
+        registry.destroy(entity);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, DestroyHalfWithComponentsAtOnce) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000);
+    std::vector<entt::DefaultRegistry::entity_type> half;
+
+    std::cout << "Destroying 500000 scattered entities with components at once" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    registry.assign<Position>(entities.begin(), entities.end());
+    registry.assign<Velocity>(entities.begin(), entities.end());
+    std::copy_if(entities.cbegin(), entities.cend(), std::back_inserter(half), [](const auto entity) { return entity % 2; });
+
+    Timer timer;
+    registry.destroy(half.begin(), half.end());
+    timer.elapsed();
+}
+
 TEST(Benchmark, IterateCreateDeleteSingleComponent) {
     entt::DefaultRegistry registry;
 
@@ -112,6 +368,34 @@ TEST(Benchmark, IterateSingleComponent1M) {
     });
 }
 
+TEST(Benchmark, IterateSingleComponentChangedSince1M) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, one component, 5% changed since the last tick" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Tracked>(entity);
+    }
+
+    const auto tick = registry.advance();
+
+    registry.view<Tracked>().each([&registry, i = 0](const auto entity, auto &) mutable {
+        if(!(i++ % 20)) {
+            registry.patch<Tracked>(entity, [](auto &tracked) { tracked.x = {}; });
+        }
+    });
+
+    auto test = [&registry, tick](auto func) {
+        Timer timer;
+        registry.view<Tracked>().each_changed_since(tick, func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &) {});
+    test([](auto, auto &tracked) { tracked.y = {}; });
+}
+
 TEST(Benchmark, IterateSingleComponentRaw1M) {
     entt::DefaultRegistry registry;
 
@@ -186,175 +470,639 @@ TEST(Benchmark, IterateTwoComponents1M) {
     });
 }
 
-TEST(Benchmark, IterateTwoComponents1MHalf) {
+TEST(Benchmark, IterateTwoComponents1MHalf) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Velocity>(entity);
+
+        if(i % 2) {
+            registry.assign<Position>(entity);
+        }
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity>().each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
+TEST(Benchmark, IterateTwoComponents1MOne) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Velocity>(entity);
+
+        if(i == 5000000L) {
+            registry.assign<Position>(entity);
+        }
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity>().each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsExclude1MHalf) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, two components, half of the entities have an excluded component" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+
+        if(i % 2) {
+            registry.assign<Comp<0>>(entity);
+        }
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity>(entt::exclude<Comp<0>>).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsExcludePersistent1MHalf) {
+    entt::DefaultRegistry registry;
+    registry.prepare<Position, Velocity>(entt::exclude<Comp<0>>);
+
+    std::cout << "Iterating over 1000000 entities, two components, half of the entities have an excluded component, persistent view" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+
+        if(i % 2) {
+            registry.assign<Comp<0>>(entity);
+        }
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity>(entt::persistent_t{}, entt::exclude<Comp<0>>).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsPersistent1M) {
+    entt::DefaultRegistry registry;
+    registry.prepare<Position, Velocity>();
+
+    std::cout << "Iterating over 1000000 entities, two components, persistent view" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.view<Position, Velocity>(entt::persistent_t{}).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsRuntime1M) {
+    entt::DefaultRegistry registry;
+    registry.prepare<Position, Velocity>();
+
+    std::cout << "Iterating over 1000000 entities, two components, runtime view" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+    }
+
+    auto test = [&registry](auto func) {
+        using component_type = typename entt::DefaultRegistry::component_type;
+        component_type types[] = { registry.type<Position>(), registry.type<Velocity>() };
+
+        Timer timer;
+        registry.view(std::begin(types), std::end(types)).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto) {});
+    test([&registry](auto entity) {
+        registry.get<Position>(entity).x = {};
+        registry.get<Velocity>(entity).x = {};
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components, runtime view" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Velocity>(entity);
+
+        if(i % 2) {
+            registry.assign<Position>(entity);
+        }
+    }
+
+    auto test = [&registry](auto func) {
+        using component_type = typename entt::DefaultRegistry::component_type;
+        component_type types[] = { registry.type<Position>(), registry.type<Velocity>() };
+
+        Timer timer;
+        registry.view(std::begin(types), std::end(types)).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto) {});
+    test([&registry](auto entity) {
+        registry.get<Position>(entity).x = {};
+        registry.get<Velocity>(entity).x = {};
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components, runtime view" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Velocity>(entity);
+
+        if(i == 5000000L) {
+            registry.assign<Position>(entity);
+        }
+    }
+
+    auto test = [&registry](auto func) {
+        using component_type = typename entt::DefaultRegistry::component_type;
+        component_type types[] = { registry.type<Position>(), registry.type<Velocity>() };
+
+        Timer timer;
+        registry.view(std::begin(types), std::end(types)).each(func);
+        timer.elapsed();
+    };
+
+    test([](auto) {});
+    test([&registry](auto entity) {
+        registry.get<Position>(entity).x = {};
+        registry.get<Velocity>(entity).x = {};
+    });
+}
+
+TEST(Benchmark, IterateTwoComponentsParallel1M) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 1000000 entities, two components, parallel" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
+    }
+
+    for(unsigned int concurrency = 1u, last = std::max(4u, std::thread::hardware_concurrency()); concurrency <= last; concurrency *= 2u) {
+        entt::JobSystem jobs{concurrency};
+        std::cout << concurrency << " thread(s): ";
+
+        Timer timer;
+        registry.view<Position, Velocity>().parallel_each(jobs, [](auto, auto &position, const auto &velocity) {
+            position.x += velocity.x * velocity.y;
+            position.y += velocity.y * velocity.x;
+        });
+        timer.elapsed();
+    }
+}
+
+TEST(Benchmark, IterateTwoComponentsParallel10M) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 10000000 entities, two components, parallel" << std::endl;
+
+    for(std::uint64_t i = 0; i < 10000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
+    }
+
+    for(unsigned int concurrency = 1u, last = std::max(4u, std::thread::hardware_concurrency()); concurrency <= last; concurrency *= 2u) {
+        entt::JobSystem jobs{concurrency};
+        std::cout << concurrency << " thread(s): ";
+
+        Timer timer;
+        registry.view<Position, Velocity>().parallel_each(jobs, [](auto, auto &position, const auto &velocity) {
+            position.x += velocity.x * velocity.y;
+            position.y += velocity.y * velocity.x;
+        });
+        timer.elapsed();
+    }
+}
+
+TEST(Benchmark, IterateTwoComponentsParallelDeterministic10M) {
+    entt::DefaultRegistry registry;
+
+    std::cout << "Iterating over 10000000 entities, two components, parallel, deterministic chunking" << std::endl;
+
+    for(std::uint64_t i = 0; i < 10000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
+    }
+
+    for(unsigned int concurrency = 1u, last = std::max(4u, std::thread::hardware_concurrency()); concurrency <= last; concurrency *= 2u) {
+        entt::JobSystem jobs{concurrency};
+        std::cout << concurrency << " thread(s): ";
+
+        Timer timer;
+        registry.view<Position, Velocity>().parallel_each(jobs, [](auto, auto &position, const auto &velocity) {
+            position.x += velocity.x * velocity.y;
+            position.y += velocity.y * velocity.x;
+        }, 16384u);
+        timer.elapsed();
+    }
+}
+
+TEST(Benchmark, JobSystemSpawn1M) {
+    entt::JobSystem jobs{};
+    std::vector<entt::JobSystem::Handle> handles;
+    std::atomic<std::uint64_t> counter{};
+
+    std::cout << "Spawning 1000000 jobs" << std::endl;
+
+    handles.reserve(1000000L);
+    Timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        handles.push_back(jobs.spawn([&counter]() { ++counter; }));
+    }
+
+    for(auto &&handle: handles) {
+        jobs.wait(handle);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, JobSystemContinuations1M) {
+    entt::JobSystem jobs{};
+    std::atomic<std::uint64_t> counter{};
+
+    std::cout << "Spawning a chain of 1000000 continuations" << std::endl;
+
+    Timer timer;
+    auto handle = jobs.spawn([&counter]() { ++counter; });
+
+    for(std::uint64_t i = 1; i < 1000000L; i++) {
+        handle = jobs.then(handle, [&counter]() { ++counter; });
+    }
+
+    jobs.wait(handle);
+    timer.elapsed();
+}
+
+TEST(Benchmark, JobSystemSteal1M) {
+    std::atomic<std::uint64_t> counter{};
+
+    std::cout << "Splitting and stealing 1000000 chunks of one index each" << std::endl;
+
+    for(unsigned int concurrency = 1u, last = std::max(4u, std::thread::hardware_concurrency()); concurrency <= last; concurrency *= 2u) {
+        entt::JobSystem jobs{concurrency};
+        std::cout << concurrency << " thread(s): ";
+
+        Timer timer;
+        jobs.parallel_for(1000000L, 1u, [&counter](auto first, auto last) {
+            counter += last - first;
+        });
+        timer.elapsed();
+    }
+}
+
+TEST(Benchmark, CreateConcurrently1M) {
+    entt::DefaultRegistry registry;
+    entt::JobSystem jobs{};
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000L);
+
+    std::cout << "Reserving 1000000 entities concurrently and flushing them" << std::endl;
+
+    Timer timer;
+
+    jobs.parallel_for(entities.size(), 0u, [&registry, &entities](auto first, auto last) {
+        for(; first < last; ++first) {
+            entities[first] = registry.create(entt::concurrent_t{});
+        }
+    });
+
+    registry.flush();
+    timer.elapsed();
+}
+
+TEST(Benchmark, CommandBufferPlayback1M) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000L);
+
+    std::cout << "Recording and playing back 1000000 entities with two components" << std::endl;
+
+    registry.create(entities.begin(), entities.end());
+    Timer timer;
+
+    for(const auto entity: entities) {
+        buffer.assign<Position>(entity, entity, entity);
+        buffer.assign<Velocity>(entity, entity, entity);
+    }
+
+    timer.elapsed();
+    Timer other;
+    buffer.playback(registry);
+    other.elapsed();
+}
+
+TEST(Benchmark, CommandBufferCreate1M) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+
+    std::cout << "Recording and playing back the creation of 1000000 entities with two components" << std::endl;
+
+    Timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto placeholder = buffer.create();
+        buffer.assign<Position>(placeholder, i, i);
+        buffer.assign<Velocity>(placeholder, i, i);
+    }
+
+    buffer.playback(registry);
+    timer.elapsed();
+}
+
+TEST(Benchmark, Clone1M) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry other;
+
+    std::cout << "Cloning a registry of 1000000 entities with two components" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
+    }
+
+    Timer timer;
+    registry.clone(other);
+    timer.elapsed();
+}
+
+TEST(Benchmark, CloneRollback1M) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry branch;
+
+    std::cout << "Rolling back a registry of 1000000 entities with two components" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
+    }
+
+    registry.clone(branch);
+    registry.view<Position>().each([](const auto, auto &position) { position.x = {}; });
+
+    Timer timer;
+    branch.clone(registry);
+    timer.elapsed();
+}
+
+TEST(Benchmark, RollbackRestore10K) {
+    entt::DefaultRegistry registry;
+    entt::RollbackBuffer<entt::DefaultRegistry::entity_type, Position, Velocity> rollback{8u};
+
+    std::cout << "Saving and restoring 1000 times a state of 10000 entities with two components" << std::endl;
+
+    for(std::uint64_t i = 0; i < 10000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
+    }
+
+    rollback.reserve(10000u);
+    Timer timer;
+
+    for(std::uint64_t tick = 0; tick < 1000L; ++tick) {
+        rollback.save(registry, tick);
+        rollback.restore(registry, tick);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, Snapshot1M) {
     entt::DefaultRegistry registry;
+    entt::DefaultRegistry other;
+    entt::OutputArchive output;
 
-    std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components" << std::endl;
+    std::cout << "Saving and loading a snapshot of 1000000 entities with two components, one at a time" << std::endl;
 
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entity = registry.create();
-        registry.assign<Velocity>(entity);
-
-        if(i % 2) {
-            registry.assign<Position>(entity);
-        }
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
     }
 
-    auto test = [&registry](auto func) {
-        Timer timer;
-        registry.view<Position, Velocity>().each(func);
-        timer.elapsed();
-    };
+    Timer timer;
+    registry.snapshot().entities(output).component<Position, Velocity>(output);
+    entt::InputArchive input{output.data(), output.size()};
+    other.restore().entities(input).component<Position, Velocity>(input);
+    timer.elapsed();
 
-    test([](auto, const auto &...) {});
-    test([](auto, auto &... comp) {
-        using accumulator_type = int[];
-        accumulator_type accumulator = { (comp.x = {}, 0)... };
-        (void)accumulator;
-    });
+    ASSERT_EQ(other.size<Velocity>(), 1000000u);
 }
 
-TEST(Benchmark, IterateTwoComponents1MOne) {
+TEST(Benchmark, SnapshotRange1M) {
     entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000000L);
+    entt::OutputArchive output;
 
-    std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components" << std::endl;
-
-    for(std::uint64_t i = 0; i < 1000000L; i++) {
-        const auto entity = registry.create();
-        registry.assign<Velocity>(entity);
-
-        if(i == 5000000L) {
-            registry.assign<Position>(entity);
-        }
-    }
+    std::cout << "Saving a snapshot of 1000000 entities with five components, two of which are empty" << std::endl;
 
-    auto test = [&registry](auto func) {
-        Timer timer;
-        registry.view<Position, Velocity>().each(func);
-        timer.elapsed();
-    };
+    registry.create(entities.begin(), entities.end());
+    registry.assign<Position>(entities.begin(), entities.end());
+    registry.assign<Velocity>(entities.begin(), entities.end());
+    registry.assign<Comp<0>>(entities.begin(), entities.end());
+    registry.reserve<Comp<1>>(0);
+    registry.reserve<Comp<2>>(0);
 
-    test([](auto, const auto &...) {});
-    test([](auto, auto &... comp) {
-        using accumulator_type = int[];
-        accumulator_type accumulator = { (comp.x = {}, 0)... };
-        (void)accumulator;
-    });
+    Timer timer;
+    registry.snapshot().component<Position, Velocity, Comp<0>, Comp<1>, Comp<2>>(output, entities.cbegin(), entities.cend());
+    timer.elapsed();
 }
 
-TEST(Benchmark, IterateTwoComponentsPersistent1M) {
+TEST(Benchmark, DeltaSnapshot1M) {
     entt::DefaultRegistry registry;
-    registry.prepare<Position, Velocity>();
+    entt::DefaultRegistry other;
+    entt::ContinuousLoader<entt::DefaultRegistry::entity_type> loader{other};
+    entt::DeltaSnapshot<entt::DefaultRegistry::entity_type, Tracked> delta{registry};
+    entt::OutputArchive output;
 
-    std::cout << "Iterating over 1000000 entities, two components, persistent view" << std::endl;
+    std::cout << "Saving and loading a delta snapshot of 1000000 entities, 1% of which changed" << std::endl;
 
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entity = registry.create();
-        registry.assign<Position>(entity);
-        registry.assign<Velocity>(entity);
+        registry.assign<Tracked>(entity, i, i);
     }
 
-    auto test = [&registry](auto func) {
-        Timer timer;
-        registry.view<Position, Velocity>(entt::persistent_t{}).each(func);
-        timer.elapsed();
-    };
+    delta.serialize({}, output);
+    entt::InputArchive base{output.data(), output.size()};
+    loader.delta<Tracked>(base);
+    output.clear();
+    const auto tick = registry.advance();
 
-    test([](auto, const auto &...) {});
-    test([](auto, auto &... comp) {
-        using accumulator_type = int[];
-        accumulator_type accumulator = { (comp.x = {}, 0)... };
-        (void)accumulator;
-    });
+    for(std::uint64_t i = 0; i < 1000000L; i += 100) {
+        const auto entity = registry.data<Tracked>()[i];
+
+        if(i % 200) {
+            registry.patch<Tracked>(entity, [](auto &tracked) { tracked.x = {}; });
+        } else {
+            registry.destroy(entity);
+        }
+    }
+
+    Timer timer;
+    delta.serialize(tick, output);
+    entt::InputArchive input{output.data(), output.size()};
+    loader.delta<Tracked>(input);
+    timer.elapsed();
+
+    ASSERT_EQ(other.size<Tracked>(), registry.size<Tracked>());
 }
 
-TEST(Benchmark, IterateTwoComponentsRuntime1M) {
+TEST(Benchmark, SnapshotBulk1M) {
     entt::DefaultRegistry registry;
-    registry.prepare<Position, Velocity>();
+    entt::DefaultRegistry other;
+    entt::OutputArchive output;
 
-    std::cout << "Iterating over 1000000 entities, two components, runtime view" << std::endl;
+    std::cout << "Saving and loading a snapshot of 1000000 entities with two components, contiguous blocks" << std::endl;
 
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entity = registry.create();
-        registry.assign<Position>(entity);
-        registry.assign<Velocity>(entity);
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
     }
 
-    auto test = [&registry](auto func) {
-        using component_type = typename entt::DefaultRegistry::component_type;
-        component_type types[] = { registry.type<Position>(), registry.type<Velocity>() };
-
-        Timer timer;
-        registry.view(std::begin(types), std::end(types)).each(func);
-        timer.elapsed();
-    };
+    Timer timer;
+    registry.snapshot().entities(output).component<Position, Velocity>(entt::raw_t{}, output);
+    entt::InputArchive input{output.data(), output.size()};
+    other.restore().entities(input).component<Position, Velocity>(entt::raw_t{}, input);
+    timer.elapsed();
 
-    test([](auto) {});
-    test([&registry](auto entity) {
-        registry.get<Position>(entity).x = {};
-        registry.get<Velocity>(entity).x = {};
-    });
+    ASSERT_EQ(other.size<Velocity>(), 1000000u);
 }
 
-TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
+TEST(Benchmark, SnapshotStream1M) {
     entt::DefaultRegistry registry;
+    entt::DefaultRegistry other;
+    std::stringstream storage;
 
-    std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components, runtime view" << std::endl;
+    std::cout << "Saving and loading a snapshot of 1000000 entities with two components through a stream" << std::endl;
 
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entity = registry.create();
-        registry.assign<Velocity>(entity);
-
-        if(i % 2) {
-            registry.assign<Position>(entity);
-        }
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
     }
 
-    auto test = [&registry](auto func) {
-        using component_type = typename entt::DefaultRegistry::component_type;
-        component_type types[] = { registry.type<Position>(), registry.type<Velocity>() };
+    Timer timer;
 
-        Timer timer;
-        registry.view(std::begin(types), std::end(types)).each(func);
-        timer.elapsed();
-    };
+    {
+        entt::OutputArchive output{storage};
+        registry.snapshot().entities(output).component<Position, Velocity>(entt::raw_t{}, output);
+    }
 
-    test([](auto) {});
-    test([&registry](auto entity) {
-        registry.get<Position>(entity).x = {};
-        registry.get<Velocity>(entity).x = {};
-    });
+    entt::InputArchive input{storage};
+    other.restore().entities(input).component<Position, Velocity>(entt::raw_t{}, input);
+    timer.elapsed();
+
+    ASSERT_EQ(other.size<Velocity>(), 1000000u);
 }
 
-TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
+#ifdef ENTT_MAPPED_FILE
+TEST(Benchmark, MappedSnapshot1M) {
+    using snapshot_type = entt::MappedSnapshot<entt::DefaultRegistry::entity_type, Position, Velocity>;
+    const char *path = "benchmark_mapped_snapshot.bin";
     entt::DefaultRegistry registry;
+    entt::DefaultRegistry other;
 
-    std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components, runtime view" << std::endl;
+    std::cout << "Loading a mapped snapshot of 1000000 entities with two components" << std::endl;
 
     for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entity = registry.create();
-        registry.assign<Velocity>(entity);
-
-        if(i == 5000000L) {
-            registry.assign<Position>(entity);
-        }
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
     }
 
-    auto test = [&registry](auto func) {
-        using component_type = typename entt::DefaultRegistry::component_type;
-        component_type types[] = { registry.type<Position>(), registry.type<Velocity>() };
+    {
+        std::ofstream file{path, std::ios::binary};
+        entt::OutputArchive output{file};
+        snapshot_type::save(registry, output);
+    }
 
-        Timer timer;
-        registry.view(std::begin(types), std::end(types)).each(func);
-        timer.elapsed();
-    };
+    Timer timer;
+    entt::MappedFile mapping{path};
+    snapshot_type{mapping.data(), mapping.size()}.load(other);
+    timer.elapsed();
 
-    test([](auto) {});
-    test([&registry](auto entity) {
-        registry.get<Position>(entity).x = {};
-        registry.get<Velocity>(entity).x = {};
-    });
+    ASSERT_EQ(other.size<Velocity>(), 1000000u);
+    std::remove(path);
 }
+#endif
 
 TEST(Benchmark, IterateFiveComponents1M) {
     entt::DefaultRegistry registry;
@@ -475,6 +1223,35 @@ TEST(Benchmark, IterateFiveComponentsPersistent1M) {
     });
 }
 
+TEST(Benchmark, IterateFiveComponentsGroup1M) {
+    entt::DefaultRegistry registry;
+    registry.group<Position, Velocity, Comp<1>, Comp<2>, Comp<3>>();
+
+    std::cout << "Iterating over 1000000 entities, five components, owning group" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity);
+        registry.assign<Velocity>(entity);
+        registry.assign<Comp<1>>(entity);
+        registry.assign<Comp<2>>(entity);
+        registry.assign<Comp<3>>(entity);
+    }
+
+    auto test = [&registry](auto func) {
+        Timer timer;
+        registry.group<Position, Velocity, Comp<1>, Comp<2>, Comp<3>>().each(func);
+        timer.elapsed();
+    };
+
+    test([](auto, const auto &...) {});
+    test([](auto, auto &... comp) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (comp.x = {}, 0)... };
+        (void)accumulator;
+    });
+}
+
 TEST(Benchmark, IterateFiveComponentsRuntime1M) {
     entt::DefaultRegistry registry;
     registry.prepare<Position, Velocity, Comp<1>, Comp<2>, Comp<3>>();
@@ -1007,3 +1784,177 @@ TEST(Benchmark, AlmostSortedInsertionSort) {
 
     timer.elapsed();
 }
+
+TEST(Benchmark, SparseSetDenseLayout) {
+    // emulates a sparse array that has one slot for each identifier up to the greatest one
+    std::vector<std::vector<entt::DefaultRegistry::entity_type>> sparse(120);
+
+    std::cout << "Constructing 1000 entities with high identifiers in 120 sets, dense sparse array" << std::endl;
+
+    Timer timer;
+    std::size_t memory{};
+
+    for(auto &&set: sparse) {
+        for(std::uint32_t i = 0; i < 1000; ++i) {
+            const auto entity = 800000 + i * 100;
+
+            if(!(entity < set.size())) {
+                set.resize(entity + 1, entt::null);
+            }
+
+            set[entity] = i;
+        }
+
+        memory += set.size() * sizeof(entt::DefaultRegistry::entity_type);
+    }
+
+    timer.elapsed();
+    std::cout << memory << " bytes" << std::endl;
+}
+
+TEST(Benchmark, SparseSetPagedLayout) {
+    std::vector<entt::SparseSet<entt::DefaultRegistry::entity_type>> sparse(120);
+
+    std::cout << "Constructing 1000 entities with high identifiers in 120 sets, paged sparse array" << std::endl;
+
+    Timer timer;
+    std::size_t memory{};
+
+    for(auto &&set: sparse) {
+        constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(entt::DefaultRegistry::entity_type);
+        auto last = ~std::size_t{};
+
+        for(std::uint32_t i = 0; i < 1000; ++i) {
+            const auto entity = 800000 + i * 100;
+            set.construct(entity);
+
+            // pages are allocated lazily, only the ones in use occupy memory
+            memory += (last != entity / entt_per_page) ? ENTT_PAGE_SIZE : 0;
+            last = entity / entt_per_page;
+        }
+    }
+
+    timer.elapsed();
+    std::cout << memory << " bytes" << std::endl;
+}
+
+TEST(Benchmark, WorldDefaultAllocator) {
+    CountingResource resource;
+
+    std::cout << "Populating and tearing down 100 worlds of 100000 entities with the default allocator" << std::endl;
+
+    Timer timer;
+
+    for(int i = 0; i < 100; ++i) {
+        entt::DefaultRegistry registry{&resource};
+        populate(registry);
+    }
+
+    timer.elapsed();
+    std::cout << resource.allocations << " allocations" << std::endl;
+}
+
+TEST(Benchmark, WorldMonotonicResource) {
+    CountingResource upstream;
+
+    std::cout << "Populating and tearing down 100 worlds of 100000 entities with a monotonic resource" << std::endl;
+
+    Timer timer;
+
+    for(int i = 0; i < 100; ++i) {
+        entt::MonotonicResource arena{1 << 20, &upstream};
+        entt::DefaultRegistry registry{&arena};
+        populate(registry);
+    }
+
+    timer.elapsed();
+    std::cout << upstream.allocations << " allocations" << std::endl;
+}
+
+template<bool Stable>
+void largeComponents() {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(100000);
+
+    registry.create(entities.begin(), entities.end());
+
+    Timer timer;
+
+    for(const auto entity: entities) {
+        registry.assign<Large<Stable>>(entity);
+    }
+
+    for(auto pos = entities.size(); pos; pos -= 2) {
+        registry.remove<Large<Stable>>(entities[pos-1]);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, LargeComponents) {
+    std::cout << "Assigning and removing 2KB components to 100000 entities" << std::endl;
+    largeComponents<false>();
+}
+
+TEST(Benchmark, LargeComponentsStableStorage) {
+    std::cout << "Assigning and removing 2KB components to 100000 entities with stable storage" << std::endl;
+    largeComponents<true>();
+}
+
+template<bool Columns>
+void integrate(entt::DefaultRegistry &registry) {
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Point<Columns>>(entity, 0.f, 0.f, 0.f);
+        registry.assign<Motion<Columns>>(entity, 1.f, 2.f, 3.f);
+    }
+}
+
+TEST(Benchmark, IntegrateArrayOfStructures) {
+    entt::DefaultRegistry registry;
+    const auto dt = .016f;
+
+    std::cout << "Integrating 1000000 entities 100 times along one axis, array of structures" << std::endl;
+
+    integrate<false>(registry);
+    auto *point = registry.raw<Point<false>>();
+    const auto *motion = registry.raw<Motion<false>>();
+    const auto size = registry.size<Point<false>>();
+
+    Timer timer;
+
+    for(int i = 0; i < 100; ++i) {
+        for(std::size_t pos = 0; pos < size; ++pos) {
+            point[pos].x += motion[pos].x * dt;
+        }
+    }
+
+    timer.elapsed();
+    ASSERT_NEAR(registry.get<Point<false>>(*registry.data<Point<false>>()).x, 1.6f, .001f);
+}
+
+TEST(Benchmark, IntegrateStructureOfArrays) {
+    entt::DefaultRegistry registry;
+    const auto dt = .016f;
+
+    std::cout << "Integrating 1000000 entities 100 times along one axis, structure of arrays" << std::endl;
+
+    integrate<true>(registry);
+    // the group keeps the columns of the two components aligned
+    auto group = registry.group<Point<true>, Motion<true>>();
+    const auto size = group.size();
+
+    Timer timer;
+
+    for(int i = 0; i < 100; ++i) {
+        auto *px = group.column(&Point<true>::x);
+        const auto *vx = group.column(&Motion<true>::x);
+
+        for(std::size_t pos = 0; pos < size; ++pos) {
+            px[pos] += vx[pos] * dt;
+        }
+    }
+
+    timer.elapsed();
+    ASSERT_NEAR(registry.get<Point<true>>(*group.data()).x, 1.6f, .001f);
+}
@@ -0,0 +1,162 @@
+#include <list>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <entt/core/memory.hpp>
+
+struct CountingResource: entt::MemoryResource {
+    void * allocate(const std::size_t size, const std::size_t) override {
+        ++allocations;
+        bytes += size;
+        return ::operator new(size);
+    }
+
+    void deallocate(void *ptr, const std::size_t size, const std::size_t) override {
+        ++deallocations;
+        bytes -= size;
+        ::operator delete(ptr);
+    }
+
+    int allocations{0};
+    int deallocations{0};
+    std::size_t bytes{0};
+};
+
+struct Base {
+    virtual ~Base() = default;
+};
+
+struct Derived: Base {
+    Derived(int &counter): counter{counter} { ++counter; }
+    ~Derived() { --counter; }
+    int &counter;
+    double value{};
+};
+
+struct Throwing {
+    Throwing() { throw 42; }
+};
+
+struct alignas(64) OverAligned {
+    char value;
+};
+
+TEST(MonotonicResource, Functionalities) {
+    CountingResource upstream;
+
+    {
+        entt::MonotonicResource resource{64u, &upstream};
+
+        ASSERT_EQ(resource.resource(), &upstream);
+        ASSERT_EQ(upstream.allocations, 0);
+
+        auto *first = resource.allocate(sizeof(std::uint64_t), alignof(std::uint64_t));
+        auto *second = resource.allocate(sizeof(std::uint64_t), alignof(std::uint64_t));
+
+        ASSERT_EQ(upstream.allocations, 1);
+        ASSERT_EQ(static_cast<char *>(second) - static_cast<char *>(first), sizeof(std::uint64_t));
+
+        resource.allocate(1u, 1u);
+        auto *aligned = resource.allocate(sizeof(std::uint64_t), alignof(std::uint64_t));
+
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % alignof(std::uint64_t), 0u);
+
+        resource.deallocate(first, sizeof(std::uint64_t), alignof(std::uint64_t));
+        resource.allocate(256u, alignof(std::max_align_t));
+
+        ASSERT_EQ(upstream.allocations, 2);
+        ASSERT_EQ(upstream.deallocations, 0);
+
+        resource.release();
+
+        ASSERT_EQ(upstream.deallocations, 2);
+        ASSERT_EQ(upstream.bytes, 0u);
+
+        resource.allocate(1u, 1u);
+
+        ASSERT_EQ(upstream.allocations, 3);
+    }
+
+    ASSERT_EQ(upstream.deallocations, 3);
+    ASSERT_EQ(upstream.bytes, 0u);
+}
+
+TEST(Allocator, Functionalities) {
+    CountingResource resource;
+    entt::Allocator<int> allocator{&resource};
+    entt::Allocator<char> other{allocator};
+
+    ASSERT_EQ(allocator.resource(), &resource);
+    ASSERT_EQ(other.resource(), &resource);
+    ASSERT_EQ(allocator, other);
+    ASSERT_NE(allocator, entt::Allocator<int>{});
+    ASSERT_EQ(entt::Allocator<int>{}.resource(), nullptr);
+
+    {
+        std::vector<int, entt::Allocator<int>> vec(allocator);
+        std::list<int, entt::Allocator<int>> list(allocator);
+
+        vec.push_back(42);
+        list.push_back(3);
+
+        ASSERT_EQ(vec.get_allocator(), allocator);
+        ASSERT_GE(resource.allocations, 2);
+    }
+
+    ASSERT_EQ(resource.allocations, resource.deallocations);
+    ASSERT_EQ(resource.bytes, 0u);
+
+    std::vector<int, entt::Allocator<int>> vec;
+    vec.push_back(42);
+
+    ASSERT_EQ(vec.get_allocator().resource(), nullptr);
+}
+
+TEST(AllocateUnique, Functionalities) {
+    CountingResource resource;
+    int counter = 0;
+
+    {
+        std::unique_ptr<Base, entt::Deleter<Base>> ptr = entt::allocate_unique<Base, Derived>(&resource, counter);
+
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(counter, 1);
+        ASSERT_EQ(resource.allocations, 1);
+        ASSERT_EQ(resource.bytes, sizeof(Derived));
+    }
+
+    ASSERT_EQ(counter, 0);
+    ASSERT_EQ(resource.deallocations, 1);
+    ASSERT_EQ(resource.bytes, 0u);
+
+    auto ptr = entt::allocate_unique<Derived>(nullptr, counter);
+
+    ASSERT_EQ(counter, 1);
+
+    ptr.reset();
+
+    ASSERT_EQ(counter, 0);
+}
+
+TEST(AllocateUnique, ThrowingConstructor) {
+    CountingResource resource;
+
+    ASSERT_THROW((entt::allocate_unique<Throwing>(&resource)), int);
+    ASSERT_EQ(resource.allocations, 1);
+    ASSERT_EQ(resource.deallocations, 1);
+    ASSERT_EQ(resource.bytes, 0u);
+}
+
+TEST(Allocator, OverAligned) {
+    std::vector<OverAligned, entt::Allocator<OverAligned>> vec;
+
+    for(auto i = 0; i < 16; ++i) {
+        vec.push_back({});
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % alignof(OverAligned), 0u);
+    }
+
+    auto ptr = entt::allocate_unique<OverAligned>(nullptr);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr.get()) % alignof(OverAligned), 0u);
+}
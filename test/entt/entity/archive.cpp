@@ -0,0 +1,205 @@
+#include <cstdint>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <entt/entity/archive.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+
+struct Position {
+    float x;
+    float y;
+};
+
+struct Relationship {
+    entt::DefaultRegistry::entity_type parent;
+};
+
+enum class Kind: std::uint16_t { first = 1, second = 0x0102 };
+
+TEST(Archive, Memory) {
+    entt::OutputArchive output;
+
+    ASSERT_EQ(output.size(), 0u);
+
+    const std::uint32_t values[]{ 1u, 2u, 3u };
+    output(std::uint32_t{42}, 'c', Kind::second);
+    output(values, 3u);
+    output(Position{1.f, 2.f});
+
+    ASSERT_EQ(output.size(), 4u + 1u + 2u + 12u + 8u);
+    // the layout is little-endian on all the platforms
+    ASSERT_EQ(output.data()[0], 42);
+    ASSERT_EQ(output.data()[5], 0x02);
+    ASSERT_EQ(output.data()[6], 0x01);
+
+    entt::InputArchive input{output.data(), output.size()};
+    std::uint32_t value{};
+    char character{};
+    Kind kind{};
+    std::uint32_t others[3]{};
+    Position position{};
+
+    input(value, character, kind);
+    input(others, 3u);
+    input(position);
+
+    ASSERT_EQ(value, 42u);
+    ASSERT_EQ(character, 'c');
+    ASSERT_EQ(kind, Kind::second);
+    ASSERT_EQ(others[0], 1u);
+    ASSERT_EQ(others[2], 3u);
+    ASSERT_EQ(position.x, 1.f);
+    ASSERT_EQ(position.y, 2.f);
+
+    output.clear();
+
+    ASSERT_EQ(output.size(), 0u);
+}
+
+TEST(Archive, Stream) {
+    std::stringstream storage;
+    std::uint64_t values[64]{};
+
+    for(std::uint64_t pos{}; pos < 64u; ++pos) {
+        values[pos] = pos;
+    }
+
+    {
+        // small thresholds force both buffered and direct writes
+        entt::OutputArchive output{storage, 16u};
+        output(std::uint64_t{1}, std::uint64_t{2});
+
+        ASSERT_EQ(output.size(), 16u);
+
+        output(std::uint64_t{3});
+
+        ASSERT_EQ(output.size(), 8u);
+
+        output(values, 64u);
+        output(std::uint64_t{4});
+    }
+
+    ASSERT_EQ(storage.str().size(), 8u * (4u + 64u));
+
+    entt::InputArchive input{storage, 16u};
+    std::uint64_t first{}, second{}, third{}, fourth{};
+    std::uint64_t others[64]{};
+
+    input(first, second, third);
+    input(others, 64u);
+    input(fourth);
+
+    ASSERT_EQ(first, 1u);
+    ASSERT_EQ(second, 2u);
+    ASSERT_EQ(third, 3u);
+    ASSERT_EQ(others[0], 0u);
+    ASSERT_EQ(others[63], 63u);
+    ASSERT_EQ(fourth, 4u);
+}
+
+TEST(Archive, Snapshot) {
+    entt::DefaultRegistry source;
+    entt::DefaultRegistry destination;
+    std::stringstream storage;
+
+    const auto e0 = source.create();
+    source.assign<Position>(e0, 16.f, 16.f);
+
+    source.destroy(source.create());
+
+    const auto e1 = source.create();
+    source.assign<Position>(e1, .8f, .0f);
+    source.assign<Relationship>(e1, e0);
+
+    {
+        entt::OutputArchive output{storage, 64u};
+        source.snapshot().entities(output).destroyed(output)
+                .component<Position>(entt::raw_t{}, output)
+                .component<Relationship>(output);
+    }
+
+    entt::InputArchive input{storage, 64u};
+    destination.restore().entities(input).destroyed(input)
+            .component<Position>(entt::raw_t{}, input)
+            .component<Relationship>(input);
+
+    ASSERT_TRUE(destination.valid(e0));
+    ASSERT_TRUE(destination.valid(e1));
+    ASSERT_EQ(destination.size(), source.size());
+    ASSERT_EQ(destination.get<Position>(e0).x, 16.f);
+    ASSERT_EQ(destination.get<Position>(e1).x, .8f);
+    ASSERT_EQ(destination.get<Relationship>(e1).parent, e0);
+}
+
+TEST(Archive, ContinuousLoader) {
+    entt::DefaultRegistry source;
+    entt::DefaultRegistry destination;
+    entt::ContinuousLoader<entt::DefaultRegistry::entity_type> loader{destination};
+    entt::OutputArchive output;
+
+    const auto e0 = source.create();
+    source.assign<Position>(e0, 1.f, 1.f);
+
+    const auto e1 = source.create();
+    source.assign<Relationship>(e1, e0);
+
+    source.snapshot().entities(output).component<Position, Relationship>(output);
+
+    entt::InputArchive input{output.data(), output.size()};
+    loader.entities(input).component<Position, Relationship>(input, &Relationship::parent).shrink();
+
+    ASSERT_TRUE(loader.has(e0));
+    ASSERT_TRUE(loader.has(e1));
+    ASSERT_EQ(destination.get<Position>(loader.map(e0)).x, 1.f);
+    ASSERT_EQ(destination.get<Relationship>(loader.map(e1)).parent, loader.map(e0));
+}
+
+TEST(Archive, Truncated) {
+    const char data[]{ 1, 0 };
+    entt::InputArchive input{data, 2u};
+    std::uint32_t value{42};
+
+    ASSERT_TRUE(input);
+
+    input(value);
+
+    ASSERT_FALSE(input);
+    ASSERT_EQ(value, 0u);
+
+    std::stringstream storage;
+    storage.write(data, 2u);
+    entt::InputArchive other{storage, 4u};
+    std::uint64_t values[4]{ 1u, 2u, 3u, 4u };
+
+    other(values, 4u);
+
+    ASSERT_FALSE(other);
+    ASSERT_EQ(values[0], 0u);
+    ASSERT_EQ(values[3], 0u);
+
+    entt::DefaultRegistry registry;
+    entt::InputArchive empty{data, 0u};
+    registry.restore().entities(empty).component<Position>(entt::raw_t{}, empty);
+
+    ASSERT_FALSE(empty);
+    ASSERT_EQ(registry.alive(), 0u);
+}
+
+TEST(Archive, MoveAssignment) {
+    std::stringstream first;
+    std::stringstream second;
+    entt::OutputArchive output{first};
+    entt::OutputArchive other{second};
+
+    output(std::uint32_t{1});
+    other(std::uint32_t{2});
+    output = std::move(other);
+
+    // pending data are written to the stream before the archive is replaced
+    ASSERT_EQ(first.str().size(), 4u);
+    ASSERT_EQ(second.str().size(), 0u);
+
+    output.flush();
+
+    ASSERT_EQ(second.str().size(), 4u);
+}
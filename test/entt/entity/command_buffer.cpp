@@ -0,0 +1,249 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/job/job_system.hpp>
+
+struct Empty {};
+
+struct alignas(16) Aligned {
+    int value;
+};
+
+TEST(CommandBuffer, Functionalities) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+
+    ASSERT_EQ(buffer.size(), 0u);
+    ASSERT_TRUE(buffer.empty());
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<int>(e0, 0);
+    registry.assign<int>(e1, 1);
+    registry.assign<char>(e1, 'c');
+
+    const auto placeholder = buffer.create();
+    buffer.assign<int>(placeholder, 42);
+    buffer.assign<std::string>(placeholder, "foo");
+    buffer.assign<Empty>(placeholder);
+    buffer.assign<int>(e2, 2);
+    buffer.replace<int>(e0, 3);
+    buffer.remove<char>(e1);
+    buffer.destroy(e1);
+    buffer.destroy(e1);
+
+    ASSERT_EQ(buffer.size(), 9u);
+    ASSERT_FALSE(buffer.empty());
+
+    // nothing reaches the registry before the playback
+    ASSERT_EQ(registry.alive(), 3u);
+    ASSERT_FALSE(registry.has<int>(e2));
+    ASSERT_EQ(registry.get<int>(e0), 0);
+
+    buffer.playback(registry);
+
+    ASSERT_EQ(buffer.size(), 0u);
+    ASSERT_TRUE(buffer.empty());
+
+    ASSERT_EQ(registry.alive(), 3u);
+    ASSERT_FALSE(registry.valid(e1));
+    ASSERT_EQ(registry.get<int>(e0), 3);
+    ASSERT_EQ(registry.get<int>(e2), 2);
+    ASSERT_EQ(registry.size<char>(), 0u);
+
+    const auto view = registry.view<int, std::string, Empty>();
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+
+    for(const auto entity: view) {
+        ASSERT_EQ(registry.get<int>(entity), 42);
+        ASSERT_EQ(registry.get<std::string>(entity), "foo");
+    }
+
+    buffer.playback(registry);
+
+    ASSERT_EQ(registry.alive(), 3u);
+}
+
+TEST(CommandBuffer, Batches) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+    std::vector<entt::DefaultRegistry::entity_type> entities(1000);
+    registry.create(entities.begin(), entities.end());
+
+    for(auto &&entity: entities) {
+        buffer.assign<Aligned>(entity, int(entity));
+        buffer.assign<int>(entity, int(entity));
+    }
+
+    for(auto &&entity: entities) {
+        if(entity % 2) {
+            buffer.remove<int>(entity);
+        } else {
+            buffer.replace<Aligned>(entity, 0);
+        }
+
+        if(entity % 3 == 0) {
+            buffer.destroy(entity);
+        }
+    }
+
+    for(auto i = 0; i < 1000; ++i) {
+        buffer.assign<Aligned>(buffer.create(), -1);
+    }
+
+    buffer.playback(registry);
+
+    ASSERT_EQ(registry.alive(), 1000u + 1000u - 334u);
+    ASSERT_EQ(registry.size<int>(), 333u);
+    ASSERT_EQ(registry.size<Aligned>(), 666u + 1000u);
+
+    registry.view<Aligned>().each([&registry](const auto entity, const auto &aligned) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&aligned) % alignof(Aligned), 0u);
+        ASSERT_EQ(registry.has<int>(entity), !(entity % 2) && aligned.value != -1);
+
+        if(aligned.value != -1) {
+            ASSERT_EQ(aligned.value, (entity % 2) ? int(entity) : 0);
+        }
+    });
+}
+
+TEST(CommandBuffer, Clear) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer buffer;
+    auto shared = std::make_shared<int>(42);
+    const auto entity = registry.create();
+
+    buffer.assign<std::shared_ptr<int>>(entity, shared);
+    buffer.assign<std::shared_ptr<int>>(buffer.create(), shared);
+
+    ASSERT_EQ(shared.use_count(), 3);
+
+    buffer.clear();
+
+    ASSERT_EQ(shared.use_count(), 1);
+    ASSERT_TRUE(buffer.empty());
+
+    buffer.assign<std::shared_ptr<int>>(entity, shared);
+
+    {
+        entt::DefaultCommandBuffer other{std::move(buffer)};
+        ASSERT_EQ(shared.use_count(), 2);
+        ASSERT_EQ(other.size(), 1u);
+        ASSERT_TRUE(buffer.empty());
+
+        buffer.assign<std::shared_ptr<int>>(buffer.create(), shared);
+        ASSERT_EQ(shared.use_count(), 3);
+
+        buffer = std::move(other);
+
+        ASSERT_EQ(shared.use_count(), 2);
+        ASSERT_EQ(buffer.size(), 1u);
+        ASSERT_TRUE(other.empty());
+    }
+
+    ASSERT_EQ(shared.use_count(), 2);
+
+    buffer.playback(registry);
+
+    ASSERT_EQ(shared.use_count(), 2);
+    ASSERT_EQ(*registry.get<std::shared_ptr<int>>(entity), 42);
+}
+
+TEST(CommandBuffer, InvalidEntities) {
+    entt::DefaultRegistry registry;
+    entt::DefaultCommandBuffer first;
+    entt::DefaultCommandBuffer second;
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+    registry.assign<int>(entity, 0);
+    registry.assign<int>(other, 0);
+
+    first.destroy(entity);
+    second.destroy(entity);
+    second.assign<char>(entity, 'c');
+    second.replace<int>(entity, 42);
+    second.remove<int>(entity);
+    second.replace<int>(other, 42);
+
+    first.playback(registry);
+    second.playback(registry);
+
+    ASSERT_FALSE(registry.valid(entity));
+    ASSERT_TRUE(registry.valid(other));
+    ASSERT_EQ(registry.get<int>(other), 42);
+    ASSERT_EQ(registry.size<int>(), 1u);
+    ASSERT_TRUE(registry.empty<char>());
+}
+
+TEST(CommandBuffer, ParallelEach) {
+    entt::DefaultRegistry registry;
+    entt::JobSystem jobs{4u};
+    std::vector<entt::DefaultCommandBuffer> buffers(jobs.concurrency());
+
+    for(auto i = 0; i < 1000; ++i) {
+        registry.assign<int>(registry.create(), i);
+    }
+
+    registry.view<int>().parallel_each(jobs, [&jobs, &buffers](const auto entity, const auto value) {
+        auto &buffer = buffers[jobs.worker()];
+
+        if(value % 2) {
+            buffer.destroy(entity);
+        } else {
+            buffer.assign<char>(entity, 'c');
+            buffer.assign<int>(buffer.create(), -value);
+        }
+    }, 10u);
+
+    for(auto &&buffer: buffers) {
+        buffer.playback(registry);
+    }
+
+    ASSERT_EQ(registry.alive(), 1000u);
+    ASSERT_EQ(registry.size<char>(), 500u);
+
+    registry.view<int>().each([&registry](const auto entity, const auto value) {
+        ASSERT_EQ(value % 2, 0);
+
+        if(value) {
+            ASSERT_EQ(registry.has<char>(entity), value > 0);
+        }
+    });
+}
+
+TEST(CommandBuffer, ConcurrentCreate) {
+    entt::DefaultRegistry registry;
+    entt::JobSystem jobs{4u};
+    std::vector<entt::DefaultCommandBuffer> buffers(jobs.concurrency());
+
+    for(auto i = 0; i < 1000; ++i) {
+        registry.assign<int>(registry.create(), i);
+    }
+
+    registry.destroy<int>();
+
+    for(auto i = 0; i < 500; ++i) {
+        registry.assign<int>(registry.create(), i);
+    }
+
+    registry.view<int>().parallel_each(jobs, [&registry, &jobs, &buffers](const auto, const auto value) {
+        const auto entity = registry.create(entt::concurrent_t{});
+        buffers[jobs.worker()].assign<char>(entity, static_cast<char>(value % 128));
+    }, 10u);
+
+    for(auto &&buffer: buffers) {
+        buffer.playback(registry);
+    }
+
+    ASSERT_EQ(registry.alive(), 1000u);
+    ASSERT_EQ(registry.size(), 1000u);
+    ASSERT_EQ(registry.size<char>(), 500u);
+}
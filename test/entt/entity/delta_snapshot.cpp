@@ -0,0 +1,193 @@
+#include <tuple>
+#include <queue>
+#include <gtest/gtest.h>
+#include <entt/entity/delta_snapshot.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+
+template<typename Storage>
+struct OutputArchive {
+    OutputArchive(Storage &storage)
+        : storage{storage}
+    {}
+
+    template<typename... Value>
+    void operator()(const Value &... value) {
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (std::get<std::queue<Value>>(storage).push(value), 0)... };
+        (void)accumulator;
+    }
+
+private:
+    Storage &storage;
+};
+
+template<typename Storage>
+struct InputArchive {
+    InputArchive(Storage &storage)
+        : storage{storage}
+    {}
+
+    template<typename... Value>
+    void operator()(Value &... value) {
+        auto assign = [this](auto &value) {
+            auto &queue = std::get<std::queue<std::decay_t<decltype(value)>>>(storage);
+            value = queue.front();
+            queue.pop();
+        };
+
+        using accumulator_type = int[];
+        accumulator_type accumulator = { (assign(value), 0)... };
+        (void)accumulator;
+    }
+
+private:
+    Storage &storage;
+};
+
+struct Position {
+    int x;
+    int y;
+};
+
+struct Parent {
+    entt::DefaultRegistry::entity_type entity;
+};
+
+namespace entt {
+    template<>
+    struct change_ticks<Position>: std::true_type {};
+
+    template<>
+    struct change_ticks<Parent>: std::true_type {};
+}
+
+TEST(DeltaSnapshot, Functionalities) {
+    using entity_type = entt::DefaultRegistry::entity_type;
+
+    using storage_type = std::tuple<
+        std::queue<entity_type>,
+        std::queue<Position>,
+        std::queue<Parent>
+    >;
+
+    entt::DefaultRegistry src;
+    entt::DefaultRegistry dst;
+    entt::ContinuousLoader<entity_type> loader{dst};
+    entt::DeltaSnapshot<entity_type, Position, Parent> delta{src};
+
+    storage_type storage;
+    OutputArchive<storage_type> output{storage};
+    InputArchive<storage_type> input{storage};
+
+    auto last = src.tick();
+
+    const auto e0 = src.create();
+    const auto e1 = src.create();
+    const auto e2 = src.create();
+    const auto e3 = src.create();
+
+    src.assign<Position>(e0, 0, 0);
+    src.assign<Position>(e1, 1, 1);
+    src.assign<Position>(e2, 2, 2);
+    src.assign<Parent>(e2, e0);
+
+    delta.serialize(last, output);
+    last = src.advance();
+    loader.delta<Position, Parent>(input, &Parent::entity);
+
+    ASSERT_TRUE(loader.has(e0));
+    ASSERT_TRUE(loader.has(e1));
+    ASSERT_TRUE(loader.has(e2));
+    ASSERT_FALSE(loader.has(e3));
+    ASSERT_EQ(dst.alive(), 3u);
+    ASSERT_EQ(dst.get<Position>(loader.map(e1)).x, 1);
+    ASSERT_EQ(dst.get<Parent>(loader.map(e2)).entity, loader.map(e0));
+
+    const auto local = loader.map(e1);
+
+    src.patch<Position>(e0, [](auto &position) { position.x = 42; });
+    src.remove<Parent>(e2);
+    src.destroy(e1);
+    src.destroy(e3);
+
+    delta.serialize(last, output);
+    last = src.advance();
+
+    // destroyed, removed and changed entities for each component, along with the sizes
+    ASSERT_EQ(std::get<std::queue<entity_type>>(storage).size(), 2u + 1u + 2u + 2u + 1u);
+    ASSERT_EQ(std::get<std::queue<Position>>(storage).size(), 1u);
+    ASSERT_TRUE(std::get<std::queue<Parent>>(storage).empty());
+
+    loader.delta<Position, Parent>(input, &Parent::entity);
+
+    ASSERT_FALSE(loader.has(e1));
+    ASSERT_FALSE(dst.valid(local));
+    ASSERT_EQ(dst.alive(), 2u);
+    ASSERT_EQ(dst.get<Position>(loader.map(e0)).x, 42);
+    ASSERT_EQ(dst.get<Position>(loader.map(e2)).x, 2);
+    ASSERT_FALSE(dst.has<Parent>(loader.map(e2)));
+
+    delta.serialize(last, output);
+    loader.delta<Position, Parent>(input, &Parent::entity);
+
+    ASSERT_EQ(dst.alive(), 2u);
+    ASSERT_TRUE(std::get<std::queue<entity_type>>(storage).empty());
+    ASSERT_TRUE(std::get<std::queue<Position>>(storage).empty());
+}
+
+TEST(DeltaSnapshot, Baselines) {
+    using entity_type = entt::DefaultRegistry::entity_type;
+
+    using storage_type = std::tuple<
+        std::queue<entity_type>,
+        std::queue<Position>,
+        std::queue<Parent>
+    >;
+
+    entt::DefaultRegistry registry;
+    entt::DeltaSnapshot<entity_type, Position> delta{registry};
+
+    storage_type storage;
+    OutputArchive<storage_type> output{storage};
+    auto &entities = std::get<std::queue<entity_type>>(storage);
+
+    const auto base = registry.tick();
+    const auto entity = registry.create();
+    registry.assign<Position>(entity, 0, 0);
+    registry.advance();
+
+    const auto tick = registry.tick();
+    registry.remove<Position>(entity);
+    registry.assign<Position>(entity, 1, 1);
+    registry.remove<Position>(entity);
+    registry.advance();
+
+    // the removal is reported once, even though the component was removed twice
+    delta.serialize(base, output);
+
+    ASSERT_EQ(entities.size(), 1u + 2u + 1u);
+    ASSERT_TRUE(std::get<std::queue<Position>>(storage).empty());
+
+    entities = {};
+    registry.assign<Position>(entity, 2, 2);
+    delta.serialize(tick, output);
+
+    ASSERT_EQ(entities.size(), 1u + 1u + 2u);
+    ASSERT_EQ(std::get<std::queue<Position>>(storage).front().x, 2);
+
+    entities = {};
+    std::get<std::queue<Position>>(storage) = {};
+    registry.remove<Position>(entity);
+    delta.discard(registry.tick());
+    delta.serialize(base, output);
+
+    // the removals recorded before the current tick are gone
+    ASSERT_EQ(entities.size(), 1u + 2u + 1u);
+
+    entities = {};
+    delta.discard(registry.tick() + 1u);
+    delta.serialize(base, output);
+
+    ASSERT_EQ(entities.size(), 1u + 1u + 1u);
+}
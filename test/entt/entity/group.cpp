@@ -0,0 +1,244 @@
+#include <tuple>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <entt/entity/group.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/job/job_system.hpp>
+
+struct Position { float x; float y; };
+struct Velocity { float x; float y; };
+
+namespace entt {
+    template<>
+    struct column_storage<Position>: std::true_type {
+        static constexpr auto members() {
+            return std::make_tuple(&Position::x, &Position::y);
+        }
+    };
+
+    template<>
+    struct column_storage<Velocity>: std::true_type {
+        static constexpr auto members() {
+            return std::make_tuple(&Velocity::x, &Velocity::y);
+        }
+    };
+}
+
+TEST(Group, Functionalities) {
+    entt::DefaultRegistry registry;
+    auto group = registry.group<int, char>();
+    const auto &cgroup = group;
+
+    ASSERT_TRUE(group.empty());
+
+    const auto e0 = registry.create();
+    registry.assign<char>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1);
+    registry.assign<char>(e1);
+
+    ASSERT_FALSE(group.empty());
+    ASSERT_NE(group.begin(), group.end());
+    ASSERT_NE(cgroup.begin(), cgroup.end());
+    ASSERT_EQ(group.size(), typename decltype(group)::size_type{1});
+    ASSERT_TRUE(group.contains(e1));
+    ASSERT_FALSE(group.contains(e0));
+
+    registry.assign<int>(e0);
+
+    ASSERT_EQ(group.size(), typename decltype(group)::size_type{2});
+    ASSERT_TRUE(group.contains(e0));
+
+    registry.remove<int>(e0);
+
+    ASSERT_EQ(group.size(), typename decltype(group)::size_type{1});
+    ASSERT_FALSE(group.contains(e0));
+
+    registry.get<char>(e0) = '1';
+    registry.get<char>(e1) = '2';
+    registry.get<int>(e1) = 42;
+
+    for(auto entity: group) {
+        ASSERT_EQ(std::get<0>(cgroup.get<int, char>(entity)), 42);
+        ASSERT_EQ(std::get<1>(group.get<int, char>(entity)), '2');
+        ASSERT_EQ(cgroup.get<char>(entity), '2');
+    }
+
+    ASSERT_EQ(*(group.data() + 0), e1);
+    ASSERT_EQ(group[0], e1);
+
+    registry.remove<char>(e0);
+    registry.remove<char>(e1);
+
+    ASSERT_EQ(group.begin(), group.end());
+    ASSERT_EQ(group.cbegin(), group.cend());
+    ASSERT_TRUE(group.empty());
+}
+
+TEST(Group, Packed) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities;
+
+    for(auto i = 0; i < 10; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+        entities.push_back(entity);
+
+        if(i % 2) {
+            registry.assign<char>(entity, char(i));
+        }
+    }
+
+    // entities already in place are arranged when the group is created
+    auto group = registry.group<int, char>();
+
+    ASSERT_EQ(group.size(), typename decltype(group)::size_type{5});
+
+    registry.assign<char>(entities[0], char(0));
+    registry.destroy(entities[3]);
+    registry.remove<int>(entities[5]);
+
+    ASSERT_EQ(group.size(), typename decltype(group)::size_type{4});
+    ASSERT_EQ(group.size(), std::size_t(std::count_if(entities.cbegin(), entities.cend(), [&registry](const auto entity) {
+        return registry.valid(entity) && registry.has<int, char>(entity);
+    })));
+
+    const auto *ints = registry.raw<int>();
+    const auto *chars = registry.raw<char>();
+    const auto *idata = registry.data<int>();
+    const auto *cdata = registry.data<char>();
+
+    for(std::size_t pos = 0; pos < group.size(); ++pos) {
+        ASSERT_EQ(idata[pos], cdata[pos]);
+        ASSERT_EQ(char(ints[pos]), chars[pos]);
+        ASSERT_TRUE(group.contains(idata[pos]));
+    }
+
+    std::size_t cnt{};
+
+    group.each([&cnt](const auto entity, int &value, char &other) {
+        ASSERT_EQ(char(value), other);
+        ASSERT_EQ(entt::DefaultRegistry::entity_type(value), entity & entt::DefaultRegistry::entity_type(0xFFFFF));
+        other = 'a';
+        ++cnt;
+    });
+
+    ASSERT_EQ(cnt, group.size());
+
+    static_cast<const decltype(group) &>(group).each([](const auto, const int &, const char &other) {
+        ASSERT_EQ(other, 'a');
+    });
+}
+
+TEST(Group, SharedLength) {
+    entt::DefaultRegistry registry;
+    auto group = registry.group<int, char>();
+
+    const auto entity = registry.create();
+    registry.assign<int>(entity);
+    registry.assign<char>(entity);
+
+    ASSERT_EQ((registry.group<int, char>().size()), typename decltype(group)::size_type{1});
+    ASSERT_EQ(group.size(), typename decltype(group)::size_type{1});
+
+    registry.reset<int>();
+
+    ASSERT_TRUE(group.empty());
+    ASSERT_TRUE((registry.group<int, char>().empty()));
+}
+
+TEST(Group, EmptyAndStableTypes) {
+    struct Empty {};
+    entt::DefaultRegistry registry;
+    auto group = registry.group<int, Empty>();
+
+    for(auto i = 0; i < 5; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i != 2) {
+            registry.assign<Empty>(entity);
+        }
+    }
+
+    ASSERT_EQ(group.size(), typename decltype(group)::size_type{4});
+
+    group.each([](const auto, int &value, Empty &) {
+        ASSERT_NE(value, 2);
+    });
+}
+
+TEST(Group, ParallelEach) {
+    entt::DefaultRegistry registry;
+    entt::JobSystem jobs{4u};
+    auto group = registry.group<int, char>();
+    const auto &cgroup = group;
+    std::atomic<int> cnt{};
+
+    for(auto i = 0; i < 1000; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, 0);
+
+        if(i % 2) {
+            registry.assign<char>(entity, 'c');
+        }
+    }
+
+    group.parallel_each(jobs, [](const auto entity, int &value, char &) { value += static_cast<int>(entity); });
+    cgroup.parallel_each(jobs, [&cnt](const auto entity, const int &value, const char &chr) {
+        ASSERT_EQ(value, static_cast<int>(entity));
+        ASSERT_EQ(chr, 'c');
+        ++cnt;
+    }, 9u);
+
+    ASSERT_EQ(cnt, 500);
+}
+
+TEST(Group, Columns) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities;
+
+    for(auto i = 0; i < 8; ++i) {
+        const auto entity = registry.create();
+        entities.push_back(entity);
+
+        if(i % 2) {
+            registry.assign<Position>(entity, float(i), 0.f);
+        }
+
+        if(i % 3) {
+            registry.assign<Velocity>(entity, 1.f, float(i));
+        }
+    }
+
+    auto group = registry.group<Position, Velocity>();
+    const auto &cgroup = group;
+
+    ASSERT_EQ(group.size(), 3u);
+
+    auto *px = group.column(&Position::x);
+    const auto *vx = cgroup.column(&Velocity::x);
+    const auto *vy = cgroup.column(&Velocity::y);
+
+    for(std::size_t pos = 0; pos < group.size(); ++pos) {
+        px[pos] += vx[pos] * 2.f;
+        ASSERT_EQ(vy[pos], float(registry.get<Velocity>(group.data()[pos]).y));
+    }
+
+    for(auto i = 0; i < 8; ++i) {
+        if(registry.has<Position, Velocity>(entities[i])) {
+            ASSERT_EQ(registry.get<Position>(entities[i]).x, float(i) + 2.f);
+        } else if(registry.has<Position>(entities[i])) {
+            ASSERT_EQ(registry.get<Position>(entities[i]).x, float(i));
+        }
+    }
+
+    registry.assign<Velocity>(entities[3], 1.f, 3.f);
+
+    ASSERT_EQ(group.size(), 4u);
+    ASSERT_EQ(group.column(&Velocity::y)[3], 3.f);
+    ASSERT_EQ(group.data()[3], entities[3]);
+}
@@ -0,0 +1,223 @@
+#include <cstdio>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <entt/entity/archive.hpp>
+#include <entt/entity/mapped_snapshot.hpp>
+#include <entt/entity/registry.hpp>
+
+struct Position {
+    float x;
+    float y;
+};
+
+struct Timer {
+    int elapsed;
+};
+
+struct Tag {};
+
+using snapshot_type = entt::MappedSnapshot<entt::DefaultRegistry::entity_type, Position, Timer, Tag>;
+
+TEST(MappedSnapshot, Functionalities) {
+    entt::DefaultRegistry source;
+    entt::DefaultRegistry destination;
+    entt::OutputArchive output;
+
+    const auto e0 = source.create();
+    source.assign<Position>(e0, 16.f, 16.f);
+    source.assign<Tag>(e0);
+
+    source.destroy(source.create());
+
+    const auto e1 = source.create();
+    source.assign<Position>(e1, .8f, .0f);
+    source.assign<Timer>(e1, 42);
+
+    const auto e2 = source.create();
+
+    snapshot_type::save(source, output);
+    const snapshot_type snapshot{output.data(), output.size()};
+
+    // sections start at offsets that are multiples of the cache line size
+    ASSERT_EQ((reinterpret_cast<const char *>(snapshot.data<Position>()) - output.data()) % ENTT_CACHE_LINE_SIZE, 0);
+    ASSERT_EQ((reinterpret_cast<const char *>(snapshot.raw<Position>()) - output.data()) % ENTT_CACHE_LINE_SIZE, 0);
+    ASSERT_EQ((reinterpret_cast<const char *>(snapshot.raw<Timer>()) - output.data()) % ENTT_CACHE_LINE_SIZE, 0);
+
+    const auto other = destination.create();
+    destination.assign<Position>(other, 0.f, 0.f);
+
+    ASSERT_TRUE(snapshot);
+    ASSERT_TRUE(snapshot.load(destination));
+    ASSERT_TRUE(destination.valid(e0));
+    ASSERT_TRUE(destination.valid(e1));
+    ASSERT_TRUE(destination.valid(e2));
+    ASSERT_EQ(destination.size(), source.size());
+    ASSERT_EQ(destination.alive(), source.alive());
+
+    ASSERT_EQ(destination.size<Position>(), 2u);
+    ASSERT_EQ(destination.get<Position>(e0).x, 16.f);
+    ASSERT_EQ(destination.get<Position>(e1).x, .8f);
+    ASSERT_EQ(destination.get<Timer>(e1).elapsed, 42);
+    ASSERT_TRUE(destination.has<Tag>(e0));
+    ASSERT_FALSE(destination.has<Tag>(e1));
+    ASSERT_TRUE(destination.orphan(e2));
+
+    // destroyed entities are recycled the same way
+    ASSERT_EQ(destination.create(), source.create());
+}
+
+TEST(MappedSnapshot, Aliasing) {
+    entt::DefaultRegistry registry;
+    entt::OutputArchive output;
+
+    for(auto i = 0; i < 8; ++i) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, float(i), float(i));
+
+        if(i % 2) {
+            registry.assign<Tag>(entity);
+        }
+    }
+
+    snapshot_type::save(registry, output);
+    const snapshot_type snapshot{output.data(), output.size()};
+
+    ASSERT_EQ(snapshot.size<Position>(), 8u);
+    ASSERT_EQ(snapshot.size<Timer>(), 0u);
+    ASSERT_EQ(snapshot.size<Tag>(), 4u);
+
+    // arrays are used in place, nothing is copied
+    ASSERT_GE(reinterpret_cast<const char *>(snapshot.raw<Position>()), output.data());
+    ASSERT_LT(reinterpret_cast<const char *>(snapshot.raw<Position>()), output.data() + output.size());
+
+    for(std::size_t pos{}; pos < snapshot.size<Position>(); ++pos) {
+        ASSERT_EQ(snapshot.data<Position>()[pos], registry.data<Position>()[pos]);
+        ASSERT_EQ(snapshot.raw<Position>()[pos].x, registry.raw<Position>()[pos].x);
+    }
+
+    for(std::size_t pos{}; pos < snapshot.size<Tag>(); ++pos) {
+        ASSERT_TRUE(registry.has<Tag>(snapshot.data<Tag>()[pos]));
+    }
+}
+
+TEST(MappedSnapshot, Validation) {
+    using entity_type = entt::DefaultRegistry::entity_type;
+    entt::DefaultRegistry registry;
+    entt::OutputArchive output;
+
+    for(auto i = 0; i < 4; ++i) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, float(i), float(i));
+        registry.assign<Timer>(entity, i);
+    }
+
+    snapshot_type::save(registry, output);
+
+    std::vector<std::uint64_t> image((output.size() + 7u) / 8u);
+    std::memcpy(image.data(), output.data(), output.size());
+    const auto *data = reinterpret_cast<const char *>(image.data());
+    const auto size = output.size();
+
+    // fields of the header for the first component (sizeof, count, entities, instances)
+    const std::size_t first = 6u;
+    const auto test = [&](std::size_t field, std::uint64_t value, std::size_t length) {
+        auto other = image;
+        other[field] = value;
+        return bool(snapshot_type{reinterpret_cast<const char *>(other.data()), length});
+    };
+
+    ASSERT_TRUE(test(0u, image[0], size));
+    ASSERT_FALSE(test(0u, 0u, size));
+    ASSERT_FALSE(test(0u, image[0], 8u));
+    ASSERT_FALSE(test(0u, image[0], size / 2u));
+    ASSERT_FALSE(test(first, sizeof(Position) + 1u, size));
+    ASSERT_FALSE(test(first + 1u, size, size));
+    ASSERT_FALSE(test(first + 1u, ~std::uint64_t{}, size));
+    ASSERT_FALSE(test(first + 2u, std::uint64_t{1} << 40, size));
+    ASSERT_FALSE(test(first + 2u, image[first + 2u] + 1u, size));
+    ASSERT_FALSE(test(first + 3u, ~std::uint64_t{}, size));
+    ASSERT_FALSE(test(4u, std::uint64_t{1} << 40, size));
+    ASSERT_FALSE(test(5u, size, size));
+
+    {
+        // too many entities in use for the size of the image
+        auto other = image;
+        const auto count = std::numeric_limits<entity_type>::max();
+        std::memcpy(reinterpret_cast<char *>(other.data()) + image[4u], &count, sizeof(count));
+
+        ASSERT_FALSE((snapshot_type{reinterpret_cast<const char *>(other.data()), size}));
+    }
+
+    const snapshot_type invalid{data, size / 2u};
+    entt::DefaultRegistry destination;
+    destination.create();
+
+    ASSERT_FALSE(invalid);
+    ASSERT_EQ(invalid.size<Position>(), 0u);
+    ASSERT_FALSE(invalid.load(destination));
+    ASSERT_EQ(destination.size(), 0u);
+
+    {
+        // entities that own components must be in use and appear once per pool
+        auto other = image;
+        auto *entities = reinterpret_cast<entity_type *>(reinterpret_cast<char *>(other.data()) + image[first + 2u]);
+        entities[1u] = entities[0u];
+        const snapshot_type snapshot{reinterpret_cast<const char *>(other.data()), size};
+
+        ASSERT_TRUE(snapshot);
+        ASSERT_FALSE(snapshot.load(destination));
+        ASSERT_EQ(destination.size(), 0u);
+
+        entities[1u] = entity_type{42};
+
+        ASSERT_FALSE(snapshot.load(destination));
+        ASSERT_EQ(destination.size(), 0u);
+    }
+
+    ASSERT_TRUE((snapshot_type{data, size}.load(destination)));
+    ASSERT_EQ(destination.get<Timer>(registry.data<Timer>()[3u]).elapsed, registry.raw<Timer>()[3u].elapsed);
+}
+
+#ifdef ENTT_MAPPED_FILE
+TEST(MappedSnapshot, MappedFile) {
+    const char *path = "mapped_snapshot.bin";
+    entt::DefaultRegistry source;
+    entt::DefaultRegistry destination;
+
+    const auto entity = source.create();
+    source.assign<Position>(entity, 1.f, 2.f);
+    source.assign<Timer>(entity, 3);
+
+    {
+        std::ofstream file{path, std::ios::binary};
+        entt::OutputArchive output{file};
+        snapshot_type::save(source, output);
+    }
+
+    ASSERT_FALSE(entt::MappedFile{"missing_mapped_snapshot.bin"});
+
+    entt::MappedFile mapping{path};
+
+    ASSERT_TRUE(mapping);
+    ASSERT_NE(mapping.data(), nullptr);
+    ASSERT_GT(mapping.size(), 0u);
+
+    entt::MappedFile other{std::move(mapping)};
+
+    ASSERT_FALSE(mapping);
+    ASSERT_TRUE(other);
+
+    snapshot_type{other.data(), other.size()}.load(destination);
+
+    ASSERT_TRUE(destination.valid(entity));
+    ASSERT_EQ(destination.get<Position>(entity).y, 2.f);
+    ASSERT_EQ(destination.get<Timer>(entity).elapsed, 3);
+    ASSERT_FALSE(destination.has<Tag>(entity));
+
+    std::remove(path);
+}
+#endif
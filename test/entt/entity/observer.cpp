@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <entt/entity/observer.hpp>
+#include <entt/entity/registry.hpp>
+
+TEST(Observer, Construction) {
+    entt::DefaultRegistry registry;
+    entt::DefaultObserver observer{registry};
+    observer.construction<int, char>();
+
+    ASSERT_TRUE(observer.empty());
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<int>(e0);
+    registry.assign<int>(e1);
+
+    ASSERT_TRUE(observer.empty());
+
+    registry.assign<char>(e0);
+
+    ASSERT_FALSE(observer.empty());
+    ASSERT_EQ(observer.size(), decltype(observer)::size_type{1});
+    ASSERT_TRUE(observer.contains(e0));
+    ASSERT_FALSE(observer.contains(e1));
+    ASSERT_EQ(*observer.begin(), e0);
+    ASSERT_EQ(*observer.data(), e0);
+
+    registry.remove<char>(e0);
+    registry.assign<char>(e0);
+
+    ASSERT_EQ(observer.size(), decltype(observer)::size_type{1});
+
+    observer.clear();
+
+    ASSERT_TRUE(observer.empty());
+    ASSERT_EQ(observer.begin(), observer.end());
+
+    registry.assign<char>(e1);
+
+    ASSERT_TRUE(observer.contains(e1));
+    ASSERT_FALSE(observer.contains(e0));
+}
+
+TEST(Observer, UpdateAndDestruction) {
+    entt::DefaultRegistry registry;
+    entt::DefaultObserver observer{registry};
+    observer.update<int>().destruction<char>();
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<int>(e0);
+    registry.assign<int>(e1);
+    registry.assign<char>(e2);
+
+    ASSERT_TRUE(observer.empty());
+
+    registry.replace<int>(e0, 42);
+    registry.accommodate<int>(e1, 3);
+    registry.accommodate<int>(e2, 0);
+
+    ASSERT_EQ(observer.size(), decltype(observer)::size_type{2});
+    ASSERT_TRUE(observer.contains(e0));
+    ASSERT_TRUE(observer.contains(e1));
+
+    registry.destroy(e2);
+
+    ASSERT_EQ(observer.size(), decltype(observer)::size_type{3});
+
+    decltype(observer)::size_type cnt{};
+    observer.each([&cnt](const auto) { ++cnt; });
+
+    ASSERT_EQ(cnt, observer.size());
+
+    observer.clear();
+    observer.disconnect();
+    registry.replace<int>(e0, 0);
+
+    ASSERT_TRUE(observer.empty());
+}
+
+TEST(Observer, Lifetime) {
+    entt::DefaultRegistry registry;
+
+    {
+        entt::DefaultObserver observer{registry};
+        observer.construction<int>().update<int>().destruction<int>();
+    }
+
+    const auto entity = registry.create();
+    registry.assign<int>(entity);
+    registry.replace<int>(entity, 1);
+    registry.remove<int>(entity);
+
+    ASSERT_TRUE(registry.orphan(entity));
+}
+
+TEST(Observer, Clone) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry branch;
+    const auto entity = registry.create();
+
+    {
+        entt::DefaultObserver observer{registry};
+        observer.construction<int>();
+
+        registry.clone(branch);
+        branch.assign<int>(branch.create());
+
+        ASSERT_TRUE(observer.empty());
+
+        branch.clone(registry);
+
+        ASSERT_TRUE(observer.empty());
+
+        registry.assign<int>(entity);
+
+        ASSERT_TRUE(observer.contains(entity));
+    }
+
+    // the branch isn't bound to the observer, it's safe to use it
+    branch.assign<int>(branch.create());
+    registry.clone(branch);
+    branch.remove<int>(entity);
+
+    ASSERT_TRUE(registry.has<int>(entity));
+}
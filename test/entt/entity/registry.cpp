@@ -1,3 +1,10 @@
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 #include <functional>
@@ -45,6 +52,47 @@ struct Listener {
     int counter{0};
 };
 
+struct StableComponent { int value; };
+
+struct ColumnComponent {
+    float x;
+    float y;
+};
+
+struct SilentComponent { int value; };
+
+struct alignas(64) AlignedComponent { int value; };
+
+struct TrackedComponent { int value; };
+
+struct CopyCounter {
+    CopyCounter(int value = 0) ENTT_NOEXCEPT: value{value} {}
+    CopyCounter(const CopyCounter &other) ENTT_NOEXCEPT: value{other.value} { ++copies; }
+    CopyCounter & operator=(const CopyCounter &other) ENTT_NOEXCEPT { value = other.value; ++copies; return *this; }
+    static int copies;
+    int value;
+};
+
+int CopyCounter::copies = 0;
+
+namespace entt {
+    template<>
+    struct stable_storage<StableComponent>: std::true_type {};
+
+    template<>
+    struct column_storage<ColumnComponent>: std::true_type {
+        static constexpr auto members() {
+            return std::make_tuple(&ColumnComponent::x, &ColumnComponent::y);
+        }
+    };
+
+    template<>
+    struct silent_update<SilentComponent>: std::true_type {};
+
+    template<>
+    struct change_ticks<TrackedComponent>: std::true_type {};
+}
+
 TEST(DefaultRegistry, Types) {
     entt::DefaultRegistry registry;
 
@@ -198,6 +246,26 @@ TEST(DefaultRegistry, Functionalities) {
     ASSERT_TRUE(registry.empty<int>());
 }
 
+TEST(DefaultRegistry, Assure) {
+    struct EmptyType {};
+    entt::DefaultRegistry registry;
+    const auto entity = registry.create();
+
+    ASSERT_EQ(registry.raw<EmptyType>(), nullptr);
+
+    registry.assure<EmptyType>();
+
+    ASSERT_NE(registry.raw<EmptyType>(), nullptr);
+    ASSERT_TRUE(registry.empty<EmptyType>());
+    ASSERT_FALSE(registry.has<EmptyType>(entity));
+
+    registry.assign<EmptyType>(entity);
+    registry.assure<EmptyType>();
+
+    ASSERT_TRUE(registry.has<EmptyType>(entity));
+    ASSERT_EQ(registry.size<EmptyType>(), 1u);
+}
+
 TEST(DefaultRegistry, Identifiers) {
     entt::DefaultRegistry registry;
     const auto pre = registry.create();
@@ -373,6 +441,209 @@ TEST(DefaultRegistry, CreateDestroyEntities) {
     ASSERT_EQ(registry.current(pre), registry.current(post));
 }
 
+TEST(DefaultRegistry, CreateManyEntitiesAtOnce) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[3];
+
+    const auto entity = registry.create();
+    registry.destroy(registry.create());
+    registry.destroy(entity);
+    registry.destroy(registry.create());
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    ASSERT_TRUE(registry.valid(entities[0]));
+    ASSERT_TRUE(registry.valid(entities[1]));
+    ASSERT_TRUE(registry.valid(entities[2]));
+
+    ASSERT_EQ(registry.entity(entities[0]), entt::DefaultRegistry::entity_type{0});
+    ASSERT_EQ(registry.version(entities[0]), entt::DefaultRegistry::version_type{2});
+
+    ASSERT_EQ(registry.entity(entities[1]), entt::DefaultRegistry::entity_type{1});
+    ASSERT_EQ(registry.version(entities[1]), entt::DefaultRegistry::version_type{1});
+
+    ASSERT_EQ(registry.entity(entities[2]), entt::DefaultRegistry::entity_type{2});
+    ASSERT_EQ(registry.version(entities[2]), entt::DefaultRegistry::version_type{0});
+
+    ASSERT_EQ(registry.size(), 3u);
+    ASSERT_TRUE(registry.orphan(entities[2]));
+}
+
+TEST(DefaultRegistry, CreateConcurrently) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[3];
+
+    const auto entity = registry.create();
+    registry.destroy(registry.create());
+    registry.destroy(entity);
+    registry.destroy(registry.create());
+
+    // same as creating the entities one at a time
+    entities[0] = registry.create(entt::concurrent_t{});
+    entities[1] = registry.create(entt::concurrent_t{});
+    entities[2] = registry.create(entt::concurrent_t{});
+
+    ASSERT_FALSE(registry.valid(entities[0]));
+    ASSERT_FALSE(registry.valid(entities[1]));
+    ASSERT_FALSE(registry.valid(entities[2]));
+    ASSERT_EQ(registry.alive(), 0u);
+
+    registry.flush();
+
+    ASSERT_TRUE(registry.valid(entities[0]));
+    ASSERT_TRUE(registry.valid(entities[1]));
+    ASSERT_TRUE(registry.valid(entities[2]));
+
+    ASSERT_EQ(registry.entity(entities[0]), entt::DefaultRegistry::entity_type{0});
+    ASSERT_EQ(registry.version(entities[0]), entt::DefaultRegistry::version_type{2});
+
+    ASSERT_EQ(registry.entity(entities[1]), entt::DefaultRegistry::entity_type{1});
+    ASSERT_EQ(registry.version(entities[1]), entt::DefaultRegistry::version_type{1});
+
+    ASSERT_EQ(registry.entity(entities[2]), entt::DefaultRegistry::entity_type{2});
+    ASSERT_EQ(registry.version(entities[2]), entt::DefaultRegistry::version_type{0});
+
+    ASSERT_EQ(registry.alive(), 3u);
+
+    registry.flush();
+
+    ASSERT_EQ(registry.alive(), 3u);
+}
+
+TEST(DefaultRegistry, CreateConcurrentlyFromThreads) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(100);
+    std::vector<entt::DefaultRegistry::entity_type> reserved;
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+
+    registry.create(entities.begin(), entities.end());
+    registry.destroy(entities.begin(), entities.begin() + 50);
+
+    for(auto i = 0; i < 4; ++i) {
+        threads.emplace_back([&registry, &reserved, &mutex]() {
+            std::vector<entt::DefaultRegistry::entity_type> local;
+
+            for(auto j = 0; j < 100; ++j) {
+                local.push_back(registry.create(entt::concurrent_t{}));
+            }
+
+            std::lock_guard<std::mutex> guard{mutex};
+            reserved.insert(reserved.end(), local.cbegin(), local.cend());
+        });
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    registry.flush();
+
+    ASSERT_EQ(registry.alive(), 450u);
+    ASSERT_EQ(registry.size(), 450u);
+    ASSERT_TRUE(std::all_of(reserved.cbegin(), reserved.cend(), [&registry](const auto entity) { return registry.valid(entity); }));
+
+    std::sort(reserved.begin(), reserved.end());
+
+    ASSERT_EQ(std::unique(reserved.begin(), reserved.end()), reserved.end());
+    ASSERT_EQ(std::count_if(reserved.cbegin(), reserved.cend(), [&registry](const auto entity) { return registry.version(entity) == 1; }), 50);
+}
+
+TEST(DefaultRegistry, AssignManyComponentsAtOnce) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[3];
+    Listener listener;
+
+    registry.construction<int>().connect<Listener, &Listener::incrComponent<int>>(&listener);
+    registry.prepare<int, char>();
+    registry.create(std::begin(entities), std::end(entities));
+    registry.assign<char>(entities[1]);
+    registry.assign<int>(std::begin(entities), std::end(entities), 42);
+
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.last, entities[2]);
+    ASSERT_EQ(registry.size<int>(), 3u);
+    ASSERT_EQ(registry.get<int>(entities[0]), 42);
+    ASSERT_EQ(registry.get<int>(entities[1]), 42);
+    ASSERT_EQ(registry.get<int>(entities[2]), 42);
+
+    auto view = registry.view<int, char>(entt::persistent_t{});
+
+    ASSERT_EQ(view.size(), 1u);
+    ASSERT_EQ(*view.begin(), entities[1]);
+
+    registry.assign<double>(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(registry.get<double>(entities[2]), 0.);
+
+    const char values[]{ 'a', 'b' };
+    registry.assign<char>(std::begin(entities) + 2, std::end(entities), std::begin(values));
+
+    ASSERT_EQ(registry.get<char>(entities[2]), 'a');
+    ASSERT_EQ(registry.size<char>(), 2u);
+    ASSERT_EQ(view.size(), 2u);
+}
+
+TEST(DefaultRegistry, DestroyManyEntitiesAtOnce) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[3];
+    Listener listener;
+
+    registry.destruction<int>().connect<Listener, &Listener::decrComponent<int>>(&listener);
+    registry.create(std::begin(entities), std::end(entities));
+    registry.assign<int>(std::begin(entities), std::end(entities));
+    registry.assign<char>(entities[0]);
+    registry.assign<double>(entities[2]);
+    registry.assign<int>(entt::tag_t{}, entities[1]);
+    registry.assign<char>(entt::tag_t{}, entities[2]);
+
+    const auto other = registry.create();
+    registry.assign<int>(other);
+    registry.assign<double>(entt::tag_t{}, other);
+
+    registry.destroy(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(listener.counter, -3);
+    ASSERT_FALSE(registry.valid(entities[0]));
+    ASSERT_FALSE(registry.valid(entities[1]));
+    ASSERT_FALSE(registry.valid(entities[2]));
+    ASSERT_TRUE(registry.valid(other));
+    ASSERT_FALSE(registry.has<int>());
+    ASSERT_FALSE(registry.has<char>());
+    ASSERT_TRUE(registry.has<double>());
+    ASSERT_EQ(registry.attachee<double>(), other);
+    ASSERT_EQ(registry.size<int>(), 1u);
+    ASSERT_TRUE(registry.empty<char>());
+    ASSERT_TRUE(registry.empty<double>());
+    ASSERT_EQ(registry.alive(), 1u);
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(registry.entity(entities[0]), entt::DefaultRegistry::entity_type{2});
+    ASSERT_EQ(registry.entity(entities[1]), entt::DefaultRegistry::entity_type{1});
+    ASSERT_EQ(registry.entity(entities[2]), entt::DefaultRegistry::entity_type{0});
+    ASSERT_EQ(registry.version(entities[0]), entt::DefaultRegistry::version_type{1});
+    ASSERT_EQ(registry.create(), entt::DefaultRegistry::entity_type{4});
+}
+
+TEST(DefaultRegistry, RemoveManyComponentsAtOnce) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[3];
+    Listener listener;
+
+    registry.destruction<int>().connect<Listener, &Listener::decrComponent<int>>(&listener);
+    registry.create(std::begin(entities), std::end(entities));
+    registry.assign<int>(std::begin(entities), std::end(entities));
+    registry.remove<int>(std::begin(entities), std::begin(entities) + 2);
+
+    ASSERT_EQ(listener.counter, -2);
+    ASSERT_EQ(listener.last, entities[1]);
+    ASSERT_FALSE(registry.has<int>(entities[0]));
+    ASSERT_FALSE(registry.has<int>(entities[1]));
+    ASSERT_TRUE(registry.has<int>(entities[2]));
+    ASSERT_EQ(registry.size<int>(), 1u);
+}
+
 TEST(DefaultRegistry, AttachSetRemoveTags) {
     entt::DefaultRegistry registry;
     const auto &cregistry = registry;
@@ -610,6 +881,178 @@ TEST(DefaultRegistry, ComponentsWithTypesFromStandardTemplateLibrary) {
     registry.destroy(entity);
 }
 
+TEST(DefaultRegistry, EmptyComponents) {
+    struct Empty {};
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<Empty>(e0);
+    registry.assign<Empty>(e1);
+    registry.assign<int>(e1, 42);
+
+    ASSERT_TRUE(registry.has<Empty>(e0));
+    ASSERT_TRUE(registry.has<Empty>(e1));
+    ASSERT_EQ(&registry.get<Empty>(e0), &registry.get<Empty>(e1));
+    ASSERT_EQ(registry.size<Empty>(), 2u);
+
+    auto count = 0u;
+
+    registry.view<Empty>().each([&](const auto, const Empty &) { ++count; });
+    registry.view<Empty, int>().each([&](const auto entity, const Empty &, const int &value) {
+        ASSERT_EQ(entity, e1);
+        ASSERT_EQ(value, 42);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 3u);
+
+    registry.remove<Empty>(e0);
+
+    ASSERT_FALSE(registry.has<Empty>(e0));
+    ASSERT_TRUE(registry.has<Empty>(e1));
+    ASSERT_EQ(registry.size<Empty>(), 1u);
+}
+
+TEST(DefaultRegistry, MemoryResource) {
+    struct CountingResource: entt::MemoryResource {
+        void * allocate(const std::size_t size, const std::size_t) override {
+            ++allocations;
+            return ::operator new(size);
+        }
+
+        void deallocate(void *ptr, const std::size_t, const std::size_t) override {
+            ++deallocations;
+            ::operator delete(ptr);
+        }
+
+        int allocations{0};
+        int deallocations{0};
+    };
+
+    CountingResource resource;
+
+    {
+        entt::DefaultRegistry registry{&resource};
+        const auto entity = registry.create();
+
+        registry.assign<int>(entity, 42);
+        registry.assign<char>(entt::tag_t{}, entity);
+        registry.prepare<int, double>();
+
+        ASSERT_EQ(registry.get<int>(entity), 42);
+        ASSERT_NE(resource.allocations, 0);
+    }
+
+    ASSERT_EQ(resource.allocations, resource.deallocations);
+
+    entt::MonotonicResource arena;
+    entt::DefaultRegistry registry{&arena};
+    entt::DefaultRegistry::entity_type entities[100];
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.assign<int>(std::begin(entities), std::end(entities), 3);
+
+    ASSERT_EQ(registry.size<int>(), 100u);
+    ASSERT_EQ(registry.get<int>(entities[42]), 3);
+}
+
+TEST(DefaultRegistry, StableComponents) {
+    entt::DefaultRegistry registry;
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    const auto *component = &registry.assign<StableComponent>(e0, 42);
+    registry.assign<StableComponent>(e1, 3);
+    registry.assign<int>(e1);
+
+    for(int i = 0; i < 10000; ++i) {
+        registry.assign<StableComponent>(registry.create(), i);
+    }
+
+    ASSERT_EQ(&registry.get<StableComponent>(e0), component);
+
+    registry.remove<StableComponent>(e0);
+
+    auto count = 0u;
+
+    registry.view<StableComponent, int>().each([&](const auto entity, const auto &stable, const int) {
+        ASSERT_EQ(entity, e1);
+        ASSERT_EQ(stable.value, 3);
+        ++count;
+    });
+
+    registry.view<StableComponent, int>(entt::persistent_t{}).each([&](const auto entity, const auto &stable, const int) {
+        ASSERT_EQ(entity, e1);
+        ASSERT_EQ(stable.value, 3);
+        ++count;
+    });
+
+    registry.view<StableComponent>().each([&](const auto entity, const auto &stable) {
+        ASSERT_EQ(registry.get<StableComponent>(entity).value, stable.value);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 10003u);
+
+    registry.compact<StableComponent>();
+    registry.compact<char>();
+
+    ASSERT_EQ(registry.get<StableComponent>(e1).value, 3);
+    ASSERT_EQ(registry.raw<StableComponent>(), &registry.get<StableComponent>(*registry.data<StableComponent>()));
+}
+
+TEST(DefaultRegistry, ColumnComponents) {
+    entt::DefaultRegistry registry;
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    ASSERT_EQ(registry.assign<ColumnComponent>(e0, 1.f, 2.f).y, 2.f);
+    registry.assign<ColumnComponent>(e1);
+
+    ASSERT_EQ(registry.get<ColumnComponent>(e0).x, 1.f);
+    ASSERT_EQ(registry.get<ColumnComponent>(e1).y, 0.f);
+    ASSERT_EQ(std::get<0>(registry.get<ColumnComponent, ColumnComponent>(e0)).y, 2.f);
+
+    ASSERT_EQ(registry.replace<ColumnComponent>(e1, 3.f, 4.f).x, 3.f);
+    ASSERT_EQ(registry.get<ColumnComponent>(e1).y, 4.f);
+    ASSERT_EQ(registry.accommodate<ColumnComponent>(e0, 5.f, 6.f).x, 5.f);
+    ASSERT_EQ(registry.get<ColumnComponent>(e0).y, 6.f);
+
+    auto view = registry.view<ColumnComponent>(entt::raw_t{});
+    auto *x = view.column(&ColumnComponent::x);
+    const auto *y = view.column(&ColumnComponent::y);
+
+    for(std::size_t pos = 0; pos < view.size(); ++pos) {
+        x[pos] += y[pos];
+    }
+
+    ASSERT_EQ(registry.get<ColumnComponent>(e0).x, 11.f);
+    ASSERT_EQ(registry.get<ColumnComponent>(e1).x, 7.f);
+
+    registry.sort<ColumnComponent>([](const auto &lhs, const auto &rhs) {
+        return lhs.x < rhs.x;
+    });
+
+    ASSERT_EQ(view[0].x, 7.f);
+    ASSERT_EQ(view[1].y, 6.f);
+
+    registry.remove<ColumnComponent>(e1);
+
+    ASSERT_EQ(view.size(), 1u);
+    ASSERT_EQ(*view.data(), e0);
+    ASSERT_EQ(*view.column(&ColumnComponent::y), 6.f);
+
+    view.each([](const ColumnComponent &component) {
+        ASSERT_EQ(component.x, 11.f);
+    });
+
+    registry.destroy(e0);
+
+    ASSERT_TRUE(view.empty());
+}
+
 TEST(DefaultRegistry, ConstructWithComponents) {
     // it should compile, that's all
     entt::DefaultRegistry registry;
@@ -672,6 +1115,240 @@ TEST(DefaultRegistry, MergeTwoRegistries) {
     ne(dst.view<char, float, int>().begin(), dst.view<char, float, int>().end());
 }
 
+TEST(DefaultRegistry, Move) {
+    entt::DefaultRegistry registry;
+    Listener listener;
+
+    registry.construction<int>().connect<Listener, &Listener::incrComponent<int>>(&listener);
+    registry.destruction<int>().connect<Listener, &Listener::decrComponent<int>>(&listener);
+    registry.construction<char>(entt::tag_t{}).connect<Listener, &Listener::incrTag<char>>(&listener);
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0, 0);
+    registry.assign<TrackedComponent>(e0, 0);
+    registry.advance();
+
+    entt::DefaultRegistry other{std::move(registry)};
+    auto view = other.view<int, TrackedComponent>(entt::persistent_t{});
+
+    // pools refer to the new registry, listeners are given it as an argument
+    const auto e1 = other.create();
+    other.assign<int>(e1, 1);
+    other.assign<TrackedComponent>(e1, 1);
+    other.assign<char>(entt::tag_t{}, e1, 'c');
+
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.last, e1);
+    ASSERT_EQ(view.size(), 2u);
+    ASSERT_TRUE(other.has<int>(e1));
+
+    std::size_t count{};
+    other.view<TrackedComponent>().each_changed_since(1u, [&count](const auto, const auto &) { ++count; });
+
+    ASSERT_EQ(count, 1u);
+
+    other.remove<int>(e0);
+
+    ASSERT_EQ(listener.counter, 2);
+    ASSERT_EQ(listener.last, e0);
+    ASSERT_EQ(view.size(), 1u);
+    ASSERT_FALSE(other.has<int>(e0));
+
+    registry = std::move(other);
+    registry.destroy(e1);
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_EQ(listener.last, e1);
+    ASSERT_FALSE(registry.valid(e1));
+    ASSERT_FALSE(registry.has<char>());
+    ASSERT_TRUE(registry.has<TrackedComponent>(e0));
+
+    registry.destroy(e0);
+
+    ASSERT_EQ(registry.alive(), 0u);
+}
+
+TEST(DefaultRegistry, Clone) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry other;
+    Listener listener;
+
+    registry.construction<int>().connect<Listener, &Listener::incrComponent<int>>(&listener);
+    registry.group<int, char>();
+    registry.view<int, double>(entt::persistent_t{});
+    registry.reserve<std::unique_ptr<int>>(0);
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+    const auto e3 = registry.create();
+
+    registry.assign<int>(e0, 0);
+    registry.assign<int>(e2, 2);
+    registry.assign<int>(e3, 3);
+    registry.assign<char>(e2, 'c');
+    registry.assign<double>(e3, .3);
+    registry.assign<std::string>(e0, "e0");
+    registry.assign<StableComponent>(e2, 42);
+    registry.assign<ColumnComponent>(e3, 1.f, 2.f);
+    registry.advance();
+    registry.assign<TrackedComponent>(e0, 99);
+    registry.advance();
+    registry.assign<float>(entt::tag_t{}, e3, 1.5f);
+    registry.destroy(e1);
+
+    other.assign<unsigned int>(other.create());
+    other.assign<int>(other.create(), 42);
+    other.assign<char>(entt::tag_t{}, other.create(), 'o');
+    other.view<unsigned int, char>(entt::persistent_t{});
+
+    listener.counter = 0;
+    registry.clone(other);
+
+    ASSERT_EQ(other.size(), registry.size());
+    ASSERT_EQ(other.alive(), registry.alive());
+    ASSERT_EQ(other.current(e1), registry.current(e1));
+    ASSERT_FALSE(other.valid(e1));
+    ASSERT_EQ(other.size<int>(), 3u);
+    ASSERT_TRUE(std::equal(registry.data<int>(), registry.data<int>() + registry.size<int>(), other.data<int>()));
+    ASSERT_TRUE(std::equal(registry.raw<int>(), registry.raw<int>() + registry.size<int>(), other.raw<int>()));
+    ASSERT_TRUE(other.empty<unsigned int>());
+    ASSERT_TRUE(other.empty<std::unique_ptr<int>>());
+    ASSERT_FALSE(other.has<char>());
+    ASSERT_TRUE((other.has<int, char, StableComponent>(e2)));
+    ASSERT_FALSE((other.has<int, char>(e0)));
+    ASSERT_EQ(other.get<std::string>(e0), "e0");
+    ASSERT_EQ(other.get<StableComponent>(e2).value, 42);
+    ASSERT_EQ(other.get<ColumnComponent>(e3).y, 2.f);
+    ASSERT_EQ(other.get<double>(e3), .3);
+    ASSERT_EQ(other.get<TrackedComponent>(e0).value, 99);
+    ASSERT_EQ(other.tick(), 2u);
+
+    other.view<TrackedComponent>().each_changed_since(0u, [e0](const auto entity, const auto &) {
+        ASSERT_EQ(entity, e0);
+    });
+
+    other.view<TrackedComponent>().each_changed_since(2u, [](const auto, const auto &) {
+        FAIL();
+    });
+
+    ASSERT_EQ(other.attachee<float>(), e3);
+    ASSERT_EQ(other.get<float>(), 1.5f);
+    ASSERT_EQ((other.group<int, char>().size()), 1u);
+    ASSERT_EQ((*other.group<int, char>().data()), e2);
+    ASSERT_EQ((other.view<int, double>(entt::persistent_t{}).size()), 1u);
+    ASSERT_EQ(listener.counter, 0);
+
+    other.get<std::string>(e0) = "other";
+
+    ASSERT_EQ(registry.get<std::string>(e0), "e0");
+
+    const auto entity = other.create();
+
+    ASSERT_EQ(entity, registry.create());
+    ASSERT_NE(entity, e1);
+
+    other.assign<char>(entity);
+    other.assign<double>(entity);
+    other.assign<int>(entity);
+
+    // listeners aren't shared with the other registry
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_EQ((other.group<int, char>().size()), 2u);
+    ASSERT_EQ((other.view<int, double>(entt::persistent_t{}).size()), 2u);
+    ASSERT_EQ((registry.group<int, char>().size()), 1u);
+    ASSERT_EQ((registry.view<int, double>(entt::persistent_t{}).size()), 1u);
+}
+
+TEST(DefaultRegistry, CloneRollback) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry branch;
+    std::vector<entt::DefaultRegistry::entity_type> entities;
+    auto group = registry.group<int, char>();
+
+    for(auto i = 0; i < 100; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+        entities.push_back(entity);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+    }
+
+    registry.clone(branch);
+
+    for(auto i = 0; i < 100; ++i) {
+        if(i % 3) {
+            registry.destroy(entities[i]);
+        } else if(!(i % 2)) {
+            registry.assign<char>(entities[i]);
+            registry.replace<int>(entities[i], -i);
+        }
+    }
+
+    ASSERT_NE(group.size(), 50u);
+
+    branch.clone(registry);
+
+    ASSERT_EQ(registry.alive(), 100u);
+    ASSERT_EQ(group.size(), 50u);
+
+    for(auto i = 0; i < 100; ++i) {
+        ASSERT_TRUE(registry.valid(entities[i]));
+        ASSERT_EQ(registry.get<int>(entities[i]), i);
+        ASSERT_EQ(registry.has<char>(entities[i]), (i % 2) == 1);
+    }
+
+    group.each([](const auto, const int value, const char) {
+        ASSERT_EQ(value % 2, 1);
+    });
+
+    registry.assign<char>(entities[0]);
+
+    ASSERT_EQ(group.size(), 51u);
+
+    registry.destroy(entities[1]);
+
+    ASSERT_EQ(group.size(), 50u);
+    ASSERT_EQ((branch.group<int, char>().size()), 50u);
+}
+
+TEST(DefaultRegistry, CloneComponents) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry other;
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<int>(e0, 0);
+    registry.assign<char>(e0, 'c');
+    registry.assign<double>(e1, .1);
+    registry.clone<int, double>(other);
+
+    ASSERT_EQ(other.alive(), 2u);
+    ASSERT_EQ(other.get<int>(e0), 0);
+    ASSERT_EQ(other.get<double>(e1), .1);
+    ASSERT_FALSE(other.has<char>(e0));
+    ASSERT_TRUE(other.empty<char>());
+
+    other.assign<char>(e1, 'o');
+    other.get<int>(e0) = 42;
+    other.remove<double>(e1);
+    registry.clone<int>(other);
+
+    ASSERT_EQ(other.get<int>(e0), 0);
+    ASSERT_TRUE(other.has<char>(e1));
+    ASSERT_FALSE(other.has<double>(e1));
+    ASSERT_FALSE(other.orphan(e0));
+
+    registry.remove<int>(e0);
+    registry.clone<int>(other);
+
+    ASSERT_FALSE(other.has<int>(e0));
+    ASSERT_TRUE(other.orphan(e0));
+}
+
 TEST(DefaultRegistry, ComponentSignals) {
     entt::DefaultRegistry registry;
     Listener listener;
@@ -825,3 +1502,215 @@ TEST(DefaultRegistry, SignalsOnAccommodate) {
 
     ASSERT_FALSE((registry.view<int, char>(entt::persistent_t{}).empty()));
 }
+
+TEST(DefaultRegistry, UpdateSignals) {
+    entt::DefaultRegistry registry;
+    Listener listener;
+
+    registry.update<int>().connect<Listener, &Listener::incrComponent<int>>(&listener);
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<int>(e0, 0);
+    registry.accommodate<int>(e1, 1);
+
+    ASSERT_EQ(listener.counter, 0);
+
+    ASSERT_EQ(registry.replace<int>(e0, 2), 2);
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_EQ(listener.last, e0);
+
+    ASSERT_EQ(registry.accommodate<int>(e1, 3), 3);
+    ASSERT_EQ(listener.counter, 2);
+    ASSERT_EQ(listener.last, e1);
+
+    ASSERT_EQ(registry.patch<int>(e0, [](auto &value) { value *= 2; }), 4);
+    ASSERT_EQ(registry.get<int>(e0), 4);
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.last, e0);
+
+    registry.update<int>().disconnect<Listener, &Listener::incrComponent<int>>(&listener);
+    registry.patch<int>(e1, [](auto &value) { ++value; });
+
+    ASSERT_EQ(registry.get<int>(e1), 4);
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.last, e0);
+}
+
+TEST(DefaultRegistry, PatchAndReplace) {
+    entt::DefaultRegistry registry;
+    const auto entity = registry.create();
+
+    registry.assign<StableComponent>(entity, 0);
+    registry.assign<ColumnComponent>(entity, 0.f, 0.f);
+    registry.assign<SilentComponent>(entity, 0);
+    registry.assign<CopyCounter>(entity, 0);
+
+    ASSERT_EQ(registry.patch<StableComponent>(entity, [](auto &instance) { instance.value = 42; }).value, 42);
+    ASSERT_EQ(registry.get<StableComponent>(entity).value, 42);
+    ASSERT_EQ(registry.replace<StableComponent>(entity, 3).value, 3);
+    ASSERT_EQ(registry.get<StableComponent>(entity).value, 3);
+
+    ASSERT_EQ(registry.patch<ColumnComponent>(entity, [](auto &instance) { instance.y = 1.f; }).y, 1.f);
+    ASSERT_EQ(registry.get<ColumnComponent>(entity).y, 1.f);
+    ASSERT_EQ(registry.replace<ColumnComponent>(entity, 2.f, 3.f).x, 2.f);
+    ASSERT_EQ(registry.get<ColumnComponent>(entity).y, 3.f);
+    // objects stored in columns are returned as const copies, changes can't be lost silently
+    ASSERT_FALSE((std::is_assignable<decltype((registry.get<ColumnComponent>(entity).x)), float>::value));
+
+    ASSERT_EQ(registry.patch<SilentComponent>(entity, [](auto &instance) { instance.value = 1; }).value, 1);
+    ASSERT_EQ(registry.replace<SilentComponent>(entity, 2).value, 2);
+    ASSERT_EQ(registry.get<SilentComponent>(entity).value, 2);
+
+    CopyCounter::copies = 0;
+    registry.replace<CopyCounter>(entity, 42);
+    registry.accommodate<CopyCounter>(entity, 3);
+    registry.patch<CopyCounter>(entity, [](auto &instance) { ++instance.value; });
+
+    ASSERT_EQ(registry.get<CopyCounter>(entity).value, 4);
+    ASSERT_EQ(CopyCounter::copies, 0);
+}
+
+TEST(DefaultRegistry, ReplaceWithAliasing) {
+    struct SharedComponent { std::shared_ptr<int> value; };
+    entt::DefaultRegistry registry;
+    const auto entity = registry.create();
+
+    registry.assign<SharedComponent>(entity, std::make_shared<int>(42));
+    registry.replace<SharedComponent>(entity, registry.get<SharedComponent>(entity));
+
+    ASSERT_EQ(*registry.get<SharedComponent>(entity).value, 42);
+
+    registry.replace<SharedComponent>(entity, registry.get<SharedComponent>(entity).value);
+    registry.accommodate<SharedComponent>(entity, std::move(registry.get<SharedComponent>(entity)));
+
+    ASSERT_EQ(*registry.get<SharedComponent>(entity).value, 42);
+    ASSERT_EQ(registry.get<SharedComponent>(entity).value.use_count(), 1);
+}
+
+TEST(DefaultRegistry, ChangeTicks) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry::entity_type entities[3];
+
+    ASSERT_EQ(registry.tick(), 0u);
+
+    registry.create(std::begin(entities), std::end(entities));
+    registry.assign<TrackedComponent>(entities[0], 0);
+
+    ASSERT_EQ(registry.advance(), 1u);
+    ASSERT_EQ(registry.tick(), 1u);
+
+    registry.assign<TrackedComponent>(entities + 1, std::end(entities));
+    registry.advance();
+    registry.replace<TrackedComponent>(entities[1], 1);
+    registry.advance();
+    registry.accommodate<TrackedComponent>(entities[2], 2);
+    registry.advance();
+    registry.patch<TrackedComponent>(entities[0], [](auto &component) { component.value = 3; });
+
+    std::size_t count{};
+
+    ASSERT_EQ(registry.tick(), 4u);
+    ASSERT_EQ(registry.size<TrackedComponent>(), 3u);
+
+    registry.view<TrackedComponent>().each_changed_since(2u, [&count](const auto, const auto &component) {
+        ASSERT_NE(component.value, 0);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 3u);
+
+    count = 0;
+    registry.view<TrackedComponent>().each_changed_since(3u, [&count](const auto, const auto &component) {
+        ASSERT_NE(component.value, 1);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2u);
+
+    count = 0;
+    registry.view<TrackedComponent>().each_changed_since(5u, [&count](const auto, const auto &) { ++count; });
+
+    ASSERT_EQ(count, 0u);
+}
+
+template<std::size_t>
+struct Many { int value; };
+
+template<std::size_t... Index>
+void assignMany(entt::DefaultRegistry &registry, const entt::DefaultRegistry::entity_type entity, std::index_sequence<Index...>) {
+    using accumulator_type = int[];
+    accumulator_type accumulator = { (registry.assign<Many<Index>>(entity), 0)... };
+    (void)accumulator;
+}
+
+void removeInt(entt::DefaultRegistry &registry, const entt::DefaultRegistry::entity_type entity) {
+    if(registry.has<int>(entity)) {
+        registry.remove<int>(entity);
+    }
+}
+
+TEST(DefaultRegistry, Signatures) {
+    entt::DefaultRegistry registry;
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<int>(e0);
+    assignMany(registry, e0, std::make_index_sequence<100>{});
+    registry.assign<Many<99>>(e1);
+    registry.assign<int>(e1);
+
+    ASSERT_TRUE((registry.has<int, Many<0>, Many<64>, Many<99>>(e0)));
+    ASSERT_FALSE((registry.has<Many<0>>(e1)));
+    ASSERT_TRUE((registry.has<int, Many<99>>(e1)));
+    ASSERT_FALSE((registry.has<Many<99>>(e2)));
+    ASSERT_FALSE(registry.orphan(e0));
+    ASSERT_FALSE(registry.orphan(e1));
+    ASSERT_TRUE(registry.orphan(e2));
+
+    registry.remove<int>(e1);
+    registry.remove<Many<99>>(e1);
+
+    ASSERT_FALSE((registry.has<Many<99>>(e1)));
+    ASSERT_TRUE(registry.orphan(e1));
+
+    registry.destruction<Many<99>>().connect<&removeInt>();
+    registry.destroy(e0);
+
+    ASSERT_EQ(registry.size<int>(), 0u);
+    ASSERT_EQ(registry.size<Many<0>>(), 0u);
+    ASSERT_EQ(registry.size<Many<99>>(), 0u);
+
+    const auto e3 = registry.create();
+    registry.assign<Many<99>>(e1);
+    registry.assign<Many<42>>(e2);
+    registry.assign<int>(e3);
+
+    ASSERT_FALSE(registry.orphan(e3));
+
+    const entt::DefaultRegistry::entity_type entities[] = { e1, e2, e3 };
+    registry.destroy(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(registry.size<int>(), 0u);
+    ASSERT_EQ(registry.size<Many<42>>(), 0u);
+    ASSERT_EQ(registry.size<Many<99>>(), 0u);
+    ASSERT_EQ(registry.alive(), 0u);
+
+    const auto e4 = registry.create();
+
+    ASSERT_TRUE(registry.orphan(e4));
+    ASSERT_FALSE((registry.has<int>(e4)));
+}
+
+TEST(DefaultRegistry, OverAlignedComponents) {
+    entt::DefaultRegistry registry;
+
+    for(auto i = 0; i < 128; ++i) {
+        registry.assign<AlignedComponent>(registry.create(), i);
+    }
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(registry.raw<AlignedComponent>()) % alignof(AlignedComponent), 0u);
+    ASSERT_EQ(registry.raw<AlignedComponent>()[127].value, 127);
+}
@@ -0,0 +1,168 @@
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/memory.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/rollback.hpp>
+
+struct Position {
+    int x;
+    int y;
+};
+
+struct Velocity {
+    int dx;
+    int dy;
+};
+
+struct Sprite {
+    int frame;
+};
+
+TEST(RollbackBuffer, Functionalities) {
+    entt::DefaultRegistry registry;
+    entt::RollbackBuffer<entt::DefaultRegistry::entity_type, Position, Velocity> rollback{4u};
+
+    ASSERT_EQ(rollback.capacity(), 4u);
+    ASSERT_FALSE(rollback.contains(0u));
+    ASSERT_FALSE(rollback.restore(registry, 0u));
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<Position>(e0, 0, 0);
+    registry.assign<Velocity>(e0, 1, 1);
+    registry.assign<Position>(e1, 10, 10);
+    registry.assign<Sprite>(e1, 0);
+
+    rollback.save(registry, 0u);
+
+    ASSERT_TRUE(rollback.contains(0u));
+    ASSERT_FALSE(rollback.contains(4u));
+
+    registry.get<Position>(e0).x = 42;
+    registry.assign<Velocity>(e1, 2, 2);
+    registry.remove<Position>(e1);
+    registry.replace<Sprite>(e1, 3);
+
+    const auto e2 = registry.create();
+    registry.assign<Position>(e2, 20, 20);
+    registry.destroy(e0);
+
+    rollback.save(registry, 1u);
+
+    ASSERT_TRUE(rollback.restore(registry, 0u));
+    ASSERT_FALSE(rollback.contains(1u));
+    ASSERT_TRUE(rollback.contains(0u));
+
+    ASSERT_TRUE(registry.valid(e0));
+    ASSERT_TRUE(registry.valid(e1));
+    ASSERT_FALSE(registry.valid(e2));
+    ASSERT_EQ(registry.alive(), 2u);
+    ASSERT_EQ(registry.size<Position>(), 2u);
+    ASSERT_EQ(registry.size<Velocity>(), 1u);
+    ASSERT_TRUE((registry.has<Position, Velocity>(e0)));
+    ASSERT_TRUE(registry.has<Position>(e1));
+    ASSERT_FALSE(registry.has<Velocity>(e1));
+    ASSERT_EQ(registry.get<Position>(e0).x, 0);
+    ASSERT_EQ(registry.get<Position>(e1).y, 10);
+    // components that aren't part of the state are left untouched
+    ASSERT_EQ(registry.get<Sprite>(e1).frame, 3);
+
+    auto count = 0u;
+
+    registry.view<Position, Velocity>().each([&count, e0](const auto entity, const auto &, const auto &) {
+        ASSERT_EQ(entity, e0);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 1u);
+
+    const auto e3 = registry.create();
+
+    ASSERT_EQ(e3, e2);
+
+    registry.assign<Position>(e3, 30, 30);
+    registry.assign<Velocity>(e3, 3, 3);
+
+    ASSERT_EQ(registry.size<Position>(), 3u);
+    ASSERT_EQ(registry.get<Position>(e3).x, 30);
+
+    rollback.clear();
+
+    ASSERT_FALSE(rollback.contains(0u));
+}
+
+TEST(RollbackBuffer, Ring) {
+    entt::DefaultRegistry registry;
+    entt::RollbackBuffer<entt::DefaultRegistry::entity_type, Position> rollback{4u};
+    std::vector<entt::DefaultRegistry::entity_type> entities;
+
+    rollback.reserve(16u);
+
+    for(auto tick = 0u; tick < 10u; ++tick) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, static_cast<int>(tick), 0);
+        entities.push_back(entity);
+        rollback.save(registry, tick);
+    }
+
+    ASSERT_FALSE(rollback.contains(5u));
+    ASSERT_TRUE(rollback.contains(6u));
+    ASSERT_TRUE(rollback.contains(9u));
+    ASSERT_FALSE(rollback.restore(registry, 2u));
+    ASSERT_TRUE(rollback.restore(registry, 7u));
+    ASSERT_TRUE(rollback.contains(6u));
+    ASSERT_FALSE(rollback.contains(8u));
+    ASSERT_FALSE(rollback.contains(9u));
+
+    ASSERT_EQ(registry.size(), 8u);
+    ASSERT_EQ(registry.size<Position>(), 8u);
+    ASSERT_FALSE(registry.valid(entities[8]));
+
+    for(auto tick = 8u; tick < 10u; ++tick) {
+        registry.assign<Position>(registry.create(), -static_cast<int>(tick), 0);
+        rollback.save(registry, tick);
+    }
+
+    ASSERT_TRUE(rollback.restore(registry, 6u));
+    ASSERT_EQ(registry.size<Position>(), 7u);
+
+    registry.view<Position>().each([](const auto entity, const auto &position) {
+        ASSERT_EQ(static_cast<entt::DefaultRegistry::entity_type>(position.x), entity);
+    });
+}
+
+TEST(RollbackBuffer, Clock) {
+    entt::DefaultRegistry registry;
+    entt::RollbackBuffer<entt::DefaultRegistry::entity_type, Position> rollback{4u};
+
+    const auto entity = registry.create();
+    registry.assign<Position>(entity, 0, 0);
+    rollback.save(registry, 0u);
+
+    registry.advance();
+    registry.advance();
+    registry.replace<Position>(entity, 1, 1);
+
+    ASSERT_EQ(registry.tick(), 2u);
+    ASSERT_TRUE(rollback.restore(registry, 0u));
+    // the clock never goes backwards
+    ASSERT_EQ(registry.tick(), 2u);
+    ASSERT_EQ(registry.get<Position>(entity).x, 0);
+    ASSERT_EQ(registry.advance(), 3u);
+}
+
+TEST(RollbackBuffer, MemoryResource) {
+    entt::MonotonicResource resource{};
+    entt::DefaultRegistry registry;
+    entt::RollbackBuffer<entt::DefaultRegistry::entity_type, Position> rollback{2u, &resource};
+
+    registry.assign<Position>(registry.create(), 1, 2);
+    rollback.save(registry, 0u);
+    registry.reset();
+
+    ASSERT_TRUE(registry.empty<Position>());
+    ASSERT_TRUE(rollback.restore(registry, 0u));
+    ASSERT_EQ(registry.size<Position>(), 1u);
+    ASSERT_EQ(registry.get<Position>(*registry.data<Position>()).y, 2);
+}
@@ -17,6 +17,17 @@ struct OutputArchive {
         (void)accumulator;
     }
 
+    template<typename Value>
+    void operator()(const Value *value, std::size_t length) {
+        ++blocks;
+
+        while(length--) {
+            std::get<std::queue<Value>>(storage).push(*(value++));
+        }
+    }
+
+    std::size_t blocks{};
+
 private:
     Storage &storage;
 };
@@ -40,6 +51,19 @@ struct InputArchive {
         (void)accumulator;
     }
 
+    template<typename Value>
+    void operator()(Value *value, std::size_t length) {
+        auto &queue = std::get<std::queue<Value>>(storage);
+        ++blocks;
+
+        while(length--) {
+            *(value++) = queue.front();
+            queue.pop();
+        }
+    }
+
+    std::size_t blocks{};
+
 private:
     Storage &storage;
 };
@@ -56,6 +80,15 @@ struct WhatAComponent {
     std::vector<entt::DefaultRegistry::entity_type> quux;
 };
 
+struct StableComponent {
+    int value;
+};
+
+namespace entt {
+    template<>
+    struct stable_storage<StableComponent>: std::true_type {};
+}
+
 TEST(Snapshot, Dump) {
     entt::DefaultRegistry registry;
 
@@ -248,6 +281,76 @@ TEST(Snapshot, Partial) {
     ASSERT_FALSE(registry.valid(e4));
 }
 
+TEST(Snapshot, Bulk) {
+    using entity_type = entt::DefaultRegistry::entity_type;
+
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0, 42);
+    registry.assign<AComponent>(e0);
+    registry.assign<StableComponent>(e0, 3);
+
+    const auto e1 = registry.create();
+    registry.assign<AnotherComponent>(e1, 1, 2);
+
+    const auto e2 = registry.create();
+    registry.assign<int>(e2, 3);
+    registry.assign<AnotherComponent>(e2, 3, 4);
+
+    registry.destroy(e1);
+    auto v1 = registry.current(e1);
+
+    using storage_type = std::tuple<
+        std::queue<entity_type>,
+        std::queue<int>,
+        std::queue<AComponent>,
+        std::queue<AnotherComponent>,
+        std::queue<StableComponent>
+    >;
+
+    storage_type storage;
+    OutputArchive<storage_type> output{storage};
+    InputArchive<storage_type> input{storage};
+
+    registry.snapshot()
+            .entities(output)
+            .destroyed(output)
+            .component<int, AComponent, AnotherComponent, StableComponent>(entt::raw_t{}, output);
+
+    // entities of all the components, instances of int and AnotherComponent
+    ASSERT_EQ(output.blocks, 5u);
+    ASSERT_TRUE(std::get<std::queue<AComponent>>(storage).empty());
+
+    registry.reset();
+
+    ASSERT_FALSE(registry.valid(e0));
+    ASSERT_FALSE(registry.valid(e2));
+
+    registry.restore()
+            .entities(input)
+            .destroyed(input)
+            .component<int, AComponent, AnotherComponent, StableComponent>(entt::raw_t{}, input);
+
+    ASSERT_EQ(input.blocks, 5u);
+
+    ASSERT_TRUE(registry.valid(e0));
+    ASSERT_FALSE(registry.valid(e1));
+    ASSERT_TRUE(registry.valid(e2));
+    ASSERT_EQ(registry.current(e1), v1);
+
+    ASSERT_EQ(registry.size<int>(), 2u);
+    ASSERT_EQ(registry.get<int>(e0), 42);
+    ASSERT_EQ(registry.get<int>(e2), 3);
+    ASSERT_TRUE(registry.has<AComponent>(e0));
+    ASSERT_FALSE(registry.has<AComponent>(e2));
+    ASSERT_EQ(registry.size<AnotherComponent>(), 1u);
+    ASSERT_EQ(registry.get<AnotherComponent>(e2).key, 3);
+    ASSERT_EQ(registry.get<AnotherComponent>(e2).value, 4);
+    ASSERT_EQ(registry.get<StableComponent>(e0).value, 3);
+    ASSERT_FALSE(registry.has<StableComponent>(e2));
+}
+
 TEST(Snapshot, Iterator) {
     entt::DefaultRegistry registry;
 
@@ -283,6 +386,58 @@ TEST(Snapshot, Iterator) {
     });
 }
 
+TEST(Snapshot, IteratorManyComponents) {
+    entt::DefaultRegistry registry;
+
+    for(auto i = 0; i < 10; ++i) {
+        const auto entity = registry.create();
+        registry.assign<AnotherComponent>(entity, i, i);
+
+        if(i % 2) {
+            registry.assign<StableComponent>(entity, i);
+        }
+    }
+
+    registry.reserve<int>(10);
+
+    using storage_type = std::tuple<
+        std::queue<entt::DefaultRegistry::entity_type>,
+        std::queue<int>,
+        std::queue<AnotherComponent>,
+        std::queue<StableComponent>
+    >;
+
+    storage_type storage;
+    OutputArchive<storage_type> output{storage};
+    InputArchive<storage_type> input{storage};
+
+    const auto *first = registry.data<AnotherComponent>() + 2;
+    registry.snapshot().component<int, AnotherComponent, StableComponent>(output, first, first + 4);
+
+    // one length per component, followed by the entities actually serialized
+    ASSERT_EQ(std::get<std::queue<entt::DefaultRegistry::entity_type>>(storage).size(), 3u + 4u + 2u);
+    ASSERT_TRUE(std::get<std::queue<int>>(storage).empty());
+
+    registry.reset();
+    registry.restore().component<int, AnotherComponent, StableComponent>(input);
+
+    ASSERT_EQ(registry.size<int>(), 0u);
+    ASSERT_EQ(registry.size<AnotherComponent>(), 4u);
+    ASSERT_EQ(registry.size<StableComponent>(), 2u);
+
+    registry.view<StableComponent>().each([&registry](const auto entity, const auto &component) {
+        ASSERT_EQ(registry.get<AnotherComponent>(entity).key, component.value);
+        ASSERT_TRUE(component.value % 2);
+    });
+
+    registry.snapshot().component<StableComponent>(output);
+    registry.reset();
+    registry.restore().component<StableComponent>(input);
+
+    ASSERT_EQ(registry.size<StableComponent>(), 2u);
+    ASSERT_FALSE(registry.has<AnotherComponent>(*registry.data<StableComponent>()));
+}
+
 TEST(Snapshot, Continuous) {
     using entity_type = entt::DefaultRegistry::entity_type;
 
@@ -1,7 +1,50 @@
 #include <unordered_set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/sparse_set.hpp>
 
+struct Stable { int value; };
+
+struct Pinned {
+    Pinned(int value): value{value} {}
+    Pinned(const Pinned &) = delete;
+    Pinned & operator=(const Pinned &) = delete;
+    int value;
+};
+
+struct Columns {
+    int value;
+    char flag;
+};
+
+struct Tracked { int value; };
+
+struct TrackedEmpty {};
+
+namespace entt {
+    template<>
+    struct stable_storage<Stable>: std::true_type {};
+
+    template<>
+    struct stable_storage<Pinned>: std::true_type {};
+
+    template<>
+    struct change_ticks<Tracked>: std::true_type {};
+
+    template<>
+    struct change_ticks<TrackedEmpty>: std::true_type {};
+
+    template<>
+    struct column_storage<Columns>: std::true_type {
+        static constexpr auto members() {
+            return std::make_tuple(&Columns::value, &Columns::flag);
+        }
+    };
+}
+
 TEST(SparseSetNoType, Functionalities) {
     entt::SparseSet<std::uint64_t> set;
     const auto &cset = set;
@@ -175,6 +218,89 @@ TEST(SparseSetNoType, Data) {
     ASSERT_EQ(*(set.data() + 2u), 42u);
 }
 
+TEST(SparseSetNoType, Pagination) {
+    entt::SparseSet<std::uint32_t> set;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(std::uint32_t);
+
+    ASSERT_EQ(set.extent(), 0u);
+
+    set.construct(entt_per_page-1);
+
+    ASSERT_EQ(set.extent(), entt_per_page);
+    ASSERT_TRUE(set.has(entt_per_page-1));
+    ASSERT_FALSE(set.has(entt_per_page));
+
+    set.construct(3*entt_per_page);
+
+    ASSERT_EQ(set.extent(), 4*entt_per_page);
+    ASSERT_TRUE(set.has(3*entt_per_page));
+    ASSERT_FALSE(set.has(entt_per_page));
+    ASSERT_FALSE(set.has(2*entt_per_page));
+    ASSERT_FALSE(set.fast(entt_per_page));
+    ASSERT_FALSE(set.fast(2*entt_per_page));
+    ASSERT_TRUE(set.fast(3*entt_per_page));
+    ASSERT_EQ(set.get(entt_per_page-1), 0u);
+    ASSERT_EQ(set.get(3*entt_per_page), 1u);
+
+    set.destroy(entt_per_page-1);
+
+    ASSERT_EQ(set.extent(), 4*entt_per_page);
+    ASSERT_FALSE(set.has(entt_per_page-1));
+    ASSERT_TRUE(set.has(3*entt_per_page));
+    ASSERT_EQ(set.get(3*entt_per_page), 0u);
+
+    set.reset();
+
+    ASSERT_EQ(set.extent(), 0u);
+    ASSERT_FALSE(set.has(3*entt_per_page));
+}
+
+TEST(SparseSetNoType, BatchConstruct) {
+    entt::SparseSet<std::uint64_t> set;
+    const std::uint64_t entities[] = { 3, 12, 42, 100000 };
+
+    set.construct(42);
+    set.construct(std::begin(entities), std::begin(entities));
+
+    ASSERT_EQ(set.size(), 1u);
+
+    set.destroy(42);
+    set.construct(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_TRUE(set.has(3));
+    ASSERT_TRUE(set.has(12));
+    ASSERT_TRUE(set.has(42));
+    ASSERT_TRUE(set.has(100000));
+    ASSERT_EQ(set.get(3), 0u);
+    ASSERT_EQ(set.get(12), 1u);
+    ASSERT_EQ(set.get(42), 2u);
+    ASSERT_EQ(set.get(100000), 3u);
+}
+
+TEST(SparseSetNoType, BatchDestroy) {
+    entt::SparseSet<std::uint64_t> set;
+    const std::uint64_t entities[] = { 3, 12, 42, 100000 };
+
+    set.construct(std::begin(entities), std::end(entities));
+    set.destroy(std::begin(entities) + 1, std::begin(entities) + 3);
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_TRUE(set.has(3));
+    ASSERT_FALSE(set.has(12));
+    ASSERT_FALSE(set.has(42));
+    ASSERT_TRUE(set.has(100000));
+
+    set.destroy(std::begin(entities), std::begin(entities));
+
+    ASSERT_EQ(set.size(), 2u);
+
+    set.destroy(std::begin(entities) + 3, std::end(entities));
+    set.destroy(std::begin(entities), std::begin(entities) + 1);
+
+    ASSERT_TRUE(set.empty());
+}
+
 TEST(SparseSetNoType, RespectDisjoint) {
     entt::SparseSet<std::uint64_t> lhs;
     entt::SparseSet<std::uint64_t> rhs;
@@ -337,6 +463,43 @@ TEST(SparseSetNoType, RespectUnordered) {
     ASSERT_EQ(rhs.get(5), 5u);
 }
 
+TEST(SparseSetNoType, Copy) {
+    entt::SparseSet<std::uint64_t> set;
+    entt::SparseSet<std::uint64_t> other;
+
+    set.construct(3);
+    set.construct(12);
+    set.construct(42);
+    set.construct(123456);
+    set.destroy(12);
+
+    other.construct(7);
+    other.construct(999999);
+    other.copy(set);
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_EQ(other.extent(), set.extent());
+    ASSERT_FALSE(other.has(7));
+    ASSERT_FALSE(other.has(999999));
+    ASSERT_FALSE(other.has(12));
+    ASSERT_TRUE(std::equal(set.begin(), set.end(), other.begin()));
+
+    for(const auto entity: set) {
+        ASSERT_EQ(other.get(entity), set.get(entity));
+    }
+
+    other.construct(12);
+
+    ASSERT_EQ(other.size(), 4u);
+    ASSERT_FALSE(set.has(12));
+
+    set.reset();
+    other.copy(set);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_FALSE(other.has(3));
+}
+
 TEST(SparseSetNoType, CanModifyDuringIteration) {
     entt::SparseSet<std::uint64_t> set;
     set.construct(0);
@@ -418,6 +581,132 @@ TEST(SparseSetWithType, ElementAccess) {
     }
 }
 
+TEST(SparseSetWithType, BatchConstruct) {
+    entt::SparseSet<std::uint64_t, int> set;
+    const std::vector<std::uint64_t> entities{ 3, 12, 42 };
+
+    set.construct(100, 0);
+    set.construct(entities.cbegin(), entities.cend(), 3);
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_EQ(set.get(100), 0);
+    ASSERT_EQ(set.get(3), 3);
+    ASSERT_EQ(set.get(12), 3);
+    ASSERT_EQ(set.get(42), 3);
+    ASSERT_EQ(*(set.data() + 1u), 3u);
+    ASSERT_EQ(*(set.data() + 3u), 42u);
+
+    entt::SparseSet<std::uint64_t, int> other;
+    other.construct(entities.cbegin(), entities.cend());
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_EQ(other.get(12), 0);
+
+    const int values[]{ 1, 2, 3 };
+    entt::SparseSet<std::uint64_t, int> copies;
+    copies.construct(100, 0);
+    copies.construct(entities.cbegin(), entities.cend(), std::begin(values));
+
+    ASSERT_EQ(copies.size(), 4u);
+    ASSERT_EQ(copies.get(3), 1);
+    ASSERT_EQ(copies.get(12), 2);
+    ASSERT_EQ(copies.get(42), 3);
+
+    const std::vector<std::string> strings{ "a", "b", "c" };
+    entt::SparseSet<std::uint64_t, std::string> others;
+    others.construct(entities.cbegin(), entities.cend(), strings.cbegin());
+
+    ASSERT_EQ(others.size(), 3u);
+    ASSERT_EQ(others.get(3), "a");
+    ASSERT_EQ(others.get(42), "c");
+}
+
+TEST(SparseSetWithType, BatchDestroy) {
+    entt::SparseSet<std::uint64_t, int> set;
+    const std::vector<std::uint64_t> entities{ 3, 12, 42 };
+
+    set.construct(3, 3);
+    set.construct(12, 12);
+    set.construct(42, 42);
+    set.destroy(entities.cbegin(), entities.cbegin() + 2);
+
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_FALSE(set.has(3));
+    ASSERT_FALSE(set.has(12));
+    ASSERT_TRUE(set.has(42));
+    ASSERT_EQ(set.get(42), 42);
+    ASSERT_EQ(*set.raw(), 42);
+
+    set.destroy(entities.cbegin() + 2, entities.cend());
+
+    ASSERT_TRUE(set.empty());
+
+    for(std::uint64_t entity = 0; entity < 10; ++entity) {
+        set.construct(entity, int(entity));
+    }
+
+    // holes are scattered and some of them are past the new end of the set
+    const std::vector<std::uint64_t> others{ 8, 1, 9, 4, 6 };
+    set.destroy(others.cbegin(), others.cend());
+
+    ASSERT_EQ(set.size(), 5u);
+
+    for(std::uint64_t entity = 0; entity < 10; ++entity) {
+        ASSERT_EQ(set.has(entity), std::find(others.cbegin(), others.cend(), entity) == others.cend());
+    }
+
+    for(std::size_t pos = 0; pos < set.size(); ++pos) {
+        ASSERT_EQ(set.get(set.data()[pos]), int(set.data()[pos]));
+        ASSERT_EQ(set.raw()[pos], int(set.data()[pos]));
+    }
+}
+
+TEST(SparseSetWithType, Swap) {
+    entt::SparseSet<std::uint64_t, int> set;
+
+    set.construct(3, 3);
+    set.construct(12, 6);
+    set.construct(42, 9);
+
+    set.swap(0u, 2u);
+
+    ASSERT_EQ(*(set.data() + 0u), 42u);
+    ASSERT_EQ(*(set.data() + 2u), 3u);
+    ASSERT_EQ(*(set.raw() + 0u), 9);
+    ASSERT_EQ(*(set.raw() + 2u), 3);
+    ASSERT_EQ(set.get(3), 3);
+    ASSERT_EQ(set.get(12), 6);
+    ASSERT_EQ(set.get(42), 9);
+}
+
+TEST(SparseSetWithType, ReplaceAndPatch) {
+    struct AggregateType { int value; };
+    entt::SparseSet<std::uint64_t, AggregateType> aggregates;
+    entt::SparseSet<std::uint64_t, std::vector<int>> vectors;
+    entt::SparseSet<std::uint64_t, Stable> stables;
+
+    aggregates.construct(3, 0);
+    vectors.construct(3);
+    stables.construct(3, 0);
+
+    ASSERT_EQ(aggregates.replace(3, 42).value, 42);
+    ASSERT_EQ(aggregates.get(3).value, 42);
+    ASSERT_EQ(aggregates.patch(3, [](auto &instance) { ++instance.value; }).value, 43);
+    ASSERT_EQ(aggregates.get(3).value, 43);
+
+    ASSERT_EQ(vectors.replace(3, 2u, 42).size(), 2u);
+    ASSERT_EQ(vectors.get(3), (std::vector<int>{42, 42}));
+    vectors.patch(3, [](auto &instance) { instance.push_back(0); });
+    ASSERT_EQ(vectors.get(3), (std::vector<int>{42, 42, 0}));
+
+    const auto *instance = &stables.get(3);
+
+    ASSERT_EQ(stables.replace(3, 42).value, 42);
+    ASSERT_EQ(&stables.get(3), instance);
+    ASSERT_EQ(&stables.patch(3, [](auto &instance) { instance.value = 3; }), instance);
+    ASSERT_EQ(instance->value, 3);
+}
+
 TEST(SparseSetWithType, AggregatesMustWork) {
     struct AggregateType { int value; };
     // the goal of this test is to enforce the requirements for aggregate types
@@ -839,6 +1128,51 @@ TEST(SparseSetWithType, RespectUnordered) {
     ASSERT_EQ(*(rhs.data() + 5u), 5u);
 }
 
+TEST(SparseSetWithType, Copy) {
+    entt::SparseSet<std::uint64_t, int> set;
+    entt::SparseSet<std::uint64_t, int> other;
+
+    set.construct(3, 3);
+    set.construct(12, 12);
+    set.construct(42, 42);
+    set.sort([](const auto lhs, const auto rhs) { return lhs > rhs; });
+
+    other.construct(7, 7);
+    other.copy(set);
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_FALSE(other.has(7));
+    ASSERT_TRUE(std::equal(set.begin(), set.end(), other.begin()));
+    ASSERT_TRUE(std::equal(set.raw(), set.raw() + set.size(), other.raw()));
+    ASSERT_EQ(other.get(12), 12);
+
+    other.get(12) = 0;
+
+    ASSERT_EQ(set.get(12), 12);
+
+    entt::SparseSet<std::uint64_t, std::string> strings;
+    entt::SparseSet<std::uint64_t, std::string> copies;
+
+    strings.construct(3, "foo");
+    strings.construct(42, "bar");
+    copies.construct(3, "quux");
+    copies.copy(strings);
+
+    ASSERT_EQ(copies.size(), 2u);
+    ASSERT_EQ(copies.get(3), "foo");
+    ASSERT_EQ(copies.get(42), "bar");
+
+    entt::SparseSet<std::uint64_t, Tracked> tracked;
+    entt::SparseSet<std::uint64_t, Tracked> stamped;
+
+    tracked.construct(3, 3);
+    tracked.stamp(3, 42u);
+    stamped.copy(tracked);
+
+    ASSERT_EQ(stamped.get(3).value, 3);
+    ASSERT_EQ(stamped.tick(3), 42u);
+}
+
 TEST(SparseSetWithType, CanModifyDuringIteration) {
     entt::SparseSet<std::uint64_t, int> set;
     set.construct(0, 42);
@@ -899,3 +1233,382 @@ TEST(SparseSetWithType, MoveOnlyComponent) {
     entt::SparseSet<std::uint64_t, MoveOnlyComponent> set;
     (void)set;
 }
+
+TEST(SparseSetWithType, EmptyType) {
+    struct EmptyType {};
+    entt::SparseSet<std::uint64_t, EmptyType> set;
+    const auto &cset = set;
+
+    set.construct(42);
+    set.construct(3);
+    set.construct(12);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_TRUE(set.has(42));
+    ASSERT_TRUE(set.has(3));
+    ASSERT_TRUE(set.has(12));
+    ASSERT_EQ(&set.get(42), &set.get(3));
+    ASSERT_EQ(&set.get(3), &cset.get(12));
+    ASSERT_EQ(set.raw(), &set.get(42));
+    ASSERT_EQ(set.begin().operator->(), &set.get(3));
+    ASSERT_EQ(set.end() - set.begin(), 3);
+    ASSERT_EQ(cset.cend() - cset.cbegin(), 3);
+
+    set.destroy(3);
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_FALSE(set.has(3));
+    ASSERT_EQ(*(set.data() + 0u), 42u);
+    ASSERT_EQ(*(set.data() + 1u), 12u);
+    ASSERT_EQ(set.end() - set.begin(), 2);
+
+    set.sort([](const auto &, const auto &) { return false; });
+
+    ASSERT_EQ(*(set.data() + 0u), 42u);
+    ASSERT_EQ(*(set.data() + 1u), 12u);
+
+    entt::SparseSet<std::uint64_t> other;
+    other.construct(12);
+    other.construct(42);
+
+    set.respect(other);
+
+    ASSERT_EQ(*(set.data() + 0u), 12u);
+    ASSERT_EQ(*(set.data() + 1u), 42u);
+
+    set.reset();
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.begin(), set.end());
+
+    // the instance is shared by all the sparse sets for the given type
+    entt::SparseSet<std::uint64_t, EmptyType> another;
+    another.construct(0);
+
+    ASSERT_EQ(&another.get(0), set.raw());
+}
+
+TEST(SparseSetWithType, EmptyTypeConstruction) {
+    struct EmptyType {
+        EmptyType() = default;
+        EmptyType(int &counter) { ++counter; }
+    };
+
+    entt::SparseSet<std::uint64_t, EmptyType> set;
+    int counter = 0;
+
+    set.construct(0, counter);
+    set.construct(1);
+    set.construct(2, counter);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(counter, 2);
+}
+
+TEST(SparseSetWithType, StableStorage) {
+    entt::SparseSet<std::uint64_t, Stable> set;
+    const auto &cset = set;
+
+    set.construct(0, 0);
+    const auto *first = &set.get(0);
+
+    for(std::uint64_t i = 1; i < 10000; ++i) {
+        set.construct(i, static_cast<int>(i));
+    }
+
+    ASSERT_EQ(&set.get(0), first);
+    ASSERT_EQ(set.get(9999).value, 9999);
+
+    const auto *hole = &set.get(42);
+    set.destroy(42);
+
+    ASSERT_FALSE(set.has(42));
+    ASSERT_EQ(&set.get(0), first);
+    ASSERT_EQ(set.get(9999).value, 9999);
+    ASSERT_EQ(set.size(), 9999u);
+
+    set.construct(42, 3);
+
+    ASSERT_EQ(&set.get(42), hole);
+    ASSERT_EQ(set.get(42).value, 3);
+
+    auto it = cset.cbegin();
+
+    for(auto pos = set.size(); pos; --pos) {
+        ASSERT_EQ(&*(it++), &set.get(*(set.data() + pos - 1)));
+    }
+
+    ASSERT_EQ(it, cset.cend());
+
+    set.sort([](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; });
+
+    ASSERT_EQ(&set.get(0), first);
+    ASSERT_EQ(&set.get(42), hole);
+    ASSERT_EQ(set.begin()->value, 0);
+    ASSERT_EQ((set.begin() + 3)->value, 3);
+    ASSERT_EQ((set.begin() + 4)->value, 3);
+}
+
+TEST(SparseSetWithType, StableStorageCopy) {
+    entt::SparseSet<std::uint64_t, Stable> set;
+    entt::SparseSet<std::uint64_t, Stable> other;
+
+    for(std::uint64_t i = 0; i < 100; ++i) {
+        set.construct(i, static_cast<int>(i));
+    }
+
+    set.destroy(42);
+    other.construct(3, 0);
+    other.copy(set);
+
+    ASSERT_EQ(other.size(), 99u);
+    ASSERT_FALSE(other.has(42));
+    ASSERT_EQ(other.get(3).value, 3);
+    ASSERT_NE(&other.get(3), &set.get(3));
+    ASSERT_TRUE(std::equal(set.begin(), set.end(), other.begin(), [](const auto &lhs, const auto &rhs) {
+        return lhs.value == rhs.value;
+    }));
+}
+
+TEST(SparseSetWithType, StableStorageCompact) {
+    entt::SparseSet<std::uint64_t, Stable> set;
+
+    set.construct(3, 3);
+    set.construct(12, 12);
+    set.construct(42, 42);
+    set.destroy(3);
+    set.construct(7, 7);
+    set.destroy(12);
+
+    ASSERT_EQ(set.size(), 2u);
+
+    set.compact();
+
+    ASSERT_EQ(set.get(42).value, 42);
+    ASSERT_EQ(set.get(7).value, 7);
+    ASSERT_EQ(set.raw(), &set.get(*set.data()));
+    ASSERT_EQ(set.raw() + 1u, &set.get(*(set.data() + 1u)));
+
+    set.construct(12, 12);
+
+    ASSERT_EQ(set.raw() + 2u, &set.get(12));
+    ASSERT_EQ(set.get(12).value, 12);
+
+    set.reset();
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.begin(), set.end());
+}
+
+TEST(SparseSetWithType, StableStorageNonMovable) {
+    entt::SparseSet<std::uint64_t, Pinned> set;
+
+    set.construct(3, 0);
+    set.construct(12, 0);
+    set.construct(42, 42);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.get(3).value, 0);
+    ASSERT_EQ(set.get(42).value, 42);
+
+    set.respect([]() {
+        entt::SparseSet<std::uint64_t> other;
+        other.construct(42);
+        other.construct(3);
+        return other;
+    }());
+
+    ASSERT_EQ(*(set.data() + 0u), 12u);
+    ASSERT_EQ(*(set.data() + 1u), 42u);
+    ASSERT_EQ(*(set.data() + 2u), 3u);
+    ASSERT_EQ(set.begin()->value, 0);
+    ASSERT_EQ((set.begin() + 1)->value, 42);
+
+    set.destroy(42);
+
+    ASSERT_EQ(set.get(12).value, 0);
+
+    entt::SparseSet<std::uint64_t, Pinned> other{std::move(set)};
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(other.get(3).value, 0);
+
+    const auto *instance = &other.get(3);
+    const std::uint64_t entities[] = { 12 };
+    other.destroy(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_EQ(&other.get(3), instance);
+}
+
+TEST(SparseSetWithType, ColumnStorage) {
+    entt::SparseSet<std::uint64_t, Columns> set;
+    const auto &cset = set;
+    const entt::SparseSet<std::uint64_t> &entities = set;
+
+    set.reserve(4);
+    set.construct(3, 3, 'c');
+    set.construct(12, 12, 'l');
+    set.construct(42, 42, 'z');
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.get(12).value, 12);
+    ASSERT_EQ(cset.get(12).flag, 'l');
+
+    const auto *value = cset.column(&Columns::value);
+    auto *flag = set.column(&Columns::flag);
+
+    for(std::size_t pos = 0; pos < set.size(); ++pos) {
+        ASSERT_EQ(value[pos], static_cast<int>(*(set.data() + pos)));
+    }
+
+    flag[entities.get(42)] = 'a';
+    set.column(&Columns::value)[1] = 0;
+
+    ASSERT_EQ(set.get(42).flag, 'a');
+    ASSERT_EQ(set.get(12).value, 0);
+
+    set.replace(12, Columns{12, 'b'});
+
+    ASSERT_EQ(set.get(12).value, 12);
+    ASSERT_EQ(set.get(12).flag, 'b');
+
+    set.patch(12, [](auto &instance) { instance.flag = 'c'; });
+
+    ASSERT_EQ(set.get(12).value, 12);
+    ASSERT_EQ(set.get(12).flag, 'c');
+
+    set.patch(12, [](auto &instance) { instance.flag = 'b'; });
+
+    set.destroy(3);
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(*set.data(), 42u);
+    ASSERT_EQ(*set.column(&Columns::value), 42);
+    ASSERT_EQ(*set.column(&Columns::flag), 'a');
+
+    set.sort([](const auto &lhs, const auto &rhs) {
+        return lhs.value < rhs.value;
+    });
+
+    ASSERT_EQ((*set.begin()).value, 12);
+    ASSERT_EQ((*(set.begin() + 1)).value, 42);
+    ASSERT_EQ(set.column(&Columns::value)[entities.get(42)], 42);
+    ASSERT_EQ(set.column(&Columns::flag)[entities.get(12)], 'b');
+
+    entt::SparseSet<std::uint64_t> other;
+    other.construct(42);
+    other.construct(7);
+    other.construct(12);
+    set.respect(other);
+
+    ASSERT_EQ((*cset.begin()).value, 12);
+    ASSERT_EQ(cset[1].flag, 'a');
+
+    const std::uint64_t range[] = { 3, 7 };
+    set.construct(std::begin(range), std::end(range), Columns{1, 'x'});
+
+    ASSERT_EQ(set.get(3).flag, 'x');
+    ASSERT_EQ(set.get(7).value, 1);
+    ASSERT_EQ(set.column(&Columns::flag)[entities.get(42)], 'a');
+
+    set.reset();
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.begin(), set.end());
+}
+
+TEST(SparseSetWithType, ColumnStorageCopy) {
+    entt::SparseSet<std::uint64_t, Columns> set;
+    entt::SparseSet<std::uint64_t, Columns> other;
+
+    set.construct(3, 3, 'c');
+    set.construct(42, 42, 'z');
+    other.copy(set);
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(other.get(3).flag, 'c');
+    ASSERT_EQ(other.get(42).value, 42);
+    ASSERT_EQ(other.column(&Columns::value)[1], 42);
+}
+
+TEST(SparseSetWithType, ChangeTicks) {
+    entt::SparseSet<std::uint64_t, Tracked> set;
+    entt::SparseSet<std::uint64_t> other;
+
+    set.construct(3, 3);
+    set.construct(12, 6);
+    set.construct(42, 9);
+
+    ASSERT_EQ(set.tick(3), 0u);
+    ASSERT_EQ(set.tick(12), 0u);
+    ASSERT_EQ(set.tick(42), 0u);
+
+    set.stamp(3, 1u);
+    set.stamp(42, 2u);
+    set.swap(0u, 2u);
+
+    ASSERT_EQ(*(set.ticks() + 0u), 2u);
+    ASSERT_EQ(*(set.ticks() + 2u), 1u);
+    ASSERT_EQ(set.tick(3), 1u);
+    ASSERT_EQ(set.tick(42), 2u);
+
+    set.sort([](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; });
+
+    ASSERT_EQ(set.tick(3), 1u);
+    ASSERT_EQ(set.tick(12), 0u);
+    ASSERT_EQ(set.tick(42), 2u);
+
+    other.construct(12);
+    other.construct(42);
+    other.construct(3);
+    set.respect(other);
+
+    ASSERT_EQ(set.tick(3), 1u);
+    ASSERT_EQ(set.tick(12), 0u);
+    ASSERT_EQ(set.tick(42), 2u);
+
+    set.destroy(3);
+
+    ASSERT_EQ(set.tick(12), 0u);
+    ASSERT_EQ(set.tick(42), 2u);
+
+    const std::uint64_t entities[] = { 1, 2 };
+    set.construct(std::begin(entities), std::end(entities));
+
+    for(std::size_t pos = 0; pos < set.size(); ++pos) {
+        ASSERT_EQ(*(set.ticks() + pos), set.tick(*(set.data() + pos)));
+    }
+
+    ASSERT_EQ(set.tick(1), 0u);
+    ASSERT_EQ(set.tick(2), 0u);
+
+    const std::uint64_t others[] = { 1, 12 };
+    set.destroy(std::begin(others), std::end(others));
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(set.tick(42), 2u);
+    ASSERT_EQ(set.tick(2), 0u);
+
+    set.reset();
+    set.construct(3, 0);
+
+    ASSERT_EQ(set.tick(3), 0u);
+}
+
+TEST(SparseSetWithType, ChangeTicksEmptyType) {
+    entt::SparseSet<std::uint64_t, TrackedEmpty> set;
+
+    set.construct(3);
+    set.construct(42);
+    set.stamp(42, 1u);
+    set.swap(0u, 1u);
+
+    ASSERT_EQ(set.tick(3), 0u);
+    ASSERT_EQ(set.tick(42), 1u);
+
+    set.destroy(3);
+
+    ASSERT_EQ(set.tick(42), 1u);
+}
@@ -0,0 +1,134 @@
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/system_graph.hpp>
+#include <entt/job/job_system.hpp>
+
+struct Position { int x; };
+struct Velocity { int x; };
+struct Sprite { int x; };
+
+TEST(SystemGraph, Functionalities) {
+    entt::DefaultRegistry registry;
+    entt::SystemGraph<entt::DefaultRegistry::entity_type, int> graph{registry};
+
+    ASSERT_EQ(graph.size(), 0u);
+    ASSERT_TRUE(graph.empty());
+
+    graph.system<entt::Read<Velocity>, entt::Write<Position>>([](auto &, auto) {});
+    graph.system<entt::Read<Velocity>>([](auto &, auto) {});
+    graph.system<entt::Read<Position, Velocity>, entt::Write<Sprite>>([](auto &, auto) {});
+    graph.system<entt::Write<Velocity>>([](auto &, auto) {});
+    graph.system([](auto &, auto) {});
+    graph.system<entt::Read<Sprite>, entt::Write<Sprite>>([](auto &, auto) {});
+
+    ASSERT_EQ(graph.size(), 6u);
+    ASSERT_FALSE(graph.empty());
+
+    ASSERT_TRUE(graph.dependencies(0u).empty());
+    ASSERT_TRUE(graph.dependencies(1u).empty());
+    ASSERT_EQ(graph.dependencies(2u), (std::vector<std::size_t>{0u}));
+    ASSERT_EQ(graph.dependencies(3u), (std::vector<std::size_t>{0u, 1u, 2u}));
+    ASSERT_TRUE(graph.dependencies(4u).empty());
+    ASSERT_EQ(graph.dependencies(5u), (std::vector<std::size_t>{2u}));
+
+    // pools are created up front
+    ASSERT_EQ(registry.size<Position>(), 0u);
+    ASSERT_TRUE(registry.view<Position>().empty());
+
+    graph.clear();
+
+    ASSERT_EQ(graph.size(), 0u);
+    ASSERT_TRUE(graph.empty());
+}
+
+TEST(SystemGraph, Run) {
+    entt::DefaultRegistry registry;
+    entt::SystemGraph<entt::DefaultRegistry::entity_type, int> graph{registry};
+    entt::JobSystem jobs{4u};
+    std::vector<int> sequence;
+    std::mutex mutex;
+
+    for(auto i = 0; i < 100; ++i) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, 0);
+        registry.assign<Velocity>(entity, 1);
+    }
+
+    auto log = [&sequence, &mutex](int value) {
+        std::lock_guard<std::mutex> guard{mutex};
+        sequence.push_back(value);
+    };
+
+    graph.system<entt::Read<Velocity>, entt::Write<Position>>([&log](auto &registry, auto delta) {
+        registry.template view<Position, Velocity>().each([delta](auto, auto &position, const auto &velocity) {
+            position.x += velocity.x * delta;
+        });
+
+        log(0);
+    });
+
+    graph.system<entt::Write<Velocity>>([&log](auto &registry, auto) {
+        registry.template view<Velocity>().each([](auto, auto &velocity) {
+            ++velocity.x;
+        });
+
+        log(1);
+    });
+
+    graph.system<entt::Read<Position>>([&log](auto &registry, auto) {
+        registry.template view<Position>().each([](auto, const auto &position) {
+            ASSERT_EQ(position.x % 2, 0);
+        });
+
+        log(2);
+    });
+
+    graph.run(2);
+
+    ASSERT_EQ(sequence, (std::vector<int>{0, 1, 2}));
+
+    for(auto i = 0; i < 10; ++i) {
+        sequence.clear();
+        graph.run(jobs, 2);
+
+        ASSERT_EQ(sequence.size(), 3u);
+        ASSERT_EQ(sequence[0], 0);
+        ASSERT_NE(sequence[1], sequence[2]);
+    }
+
+    registry.view<Position, Velocity>().each([](auto, const auto &position, const auto &velocity) {
+        ASSERT_EQ(velocity.x, 12);
+        ASSERT_EQ(position.x, 2 * (1 + 2 + 3 + 4 + 5 + 6 + 7 + 8 + 9 + 10 + 11));
+    });
+}
+
+TEST(SystemGraph, Parallel) {
+    entt::DefaultRegistry registry;
+    entt::SystemGraph<entt::DefaultRegistry::entity_type, int> graph{registry};
+    entt::JobSystem jobs{4u};
+    std::atomic<int> arrived{};
+
+    auto barrier = [&arrived](auto &, auto) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+        ++arrived;
+
+        // returns as soon as both the systems are running at the same time
+        while(arrived.load() < 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+
+        ASSERT_EQ(arrived.load(), 2);
+    };
+
+    graph.system<entt::Read<Position, Velocity>>(barrier);
+    graph.system<entt::Read<Position>, entt::Write<Sprite>>(barrier);
+
+    graph.run(jobs, 0);
+
+    ASSERT_EQ(arrived, 2);
+}
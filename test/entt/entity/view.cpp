@@ -1,9 +1,19 @@
+#include <atomic>
 #include <utility>
 #include <iterator>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/job/job_system.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/view.hpp>
 
+struct Tracked { int value; };
+
+namespace entt {
+    template<>
+    struct change_ticks<Tracked>: std::true_type {};
+}
+
 TEST(PersistentView, Prepare) {
     entt::DefaultRegistry registry;
     registry.prepare<int, char>();
@@ -191,6 +201,32 @@ TEST(PersistentView, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(PersistentView, ParallelEach) {
+    entt::DefaultRegistry registry;
+    entt::JobSystem jobs{4u};
+    auto view = registry.view<int, char>(entt::persistent_t{});
+    const auto &cview = view;
+    std::atomic<int> cnt{};
+
+    for(auto i = 0; i < 1000; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, 0);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+    }
+
+    view.parallel_each(jobs, [&cnt](const auto, int &value, char &) { ++value; ++cnt; });
+    cview.parallel_each(jobs, [&cnt](const auto, const int &value, const char &) { cnt += value; }, 7u);
+
+    ASSERT_EQ(cnt, 1000);
+
+    registry.view<int>().each([](const auto entity, const int value) {
+        ASSERT_EQ(value, int(entity % 2));
+    });
+}
+
 TEST(PersistentView, Sort) {
     entt::DefaultRegistry registry;
     registry.prepare<int, unsigned int>();
@@ -226,6 +262,105 @@ TEST(PersistentView, Sort) {
     }
 }
 
+TEST(PersistentView, Exclude) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0, 0);
+    registry.assign<char>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1, 1);
+    registry.assign<char>(e1);
+    registry.assign<double>(e1);
+
+    auto view = registry.view<int, char>(entt::persistent_t{}, entt::exclude<double>);
+
+    ASSERT_TRUE((registry.contains<int, char>(entt::exclude<double>)));
+    ASSERT_FALSE((registry.contains<int, char>()));
+    ASSERT_EQ(view.size(), typename decltype(view)::size_type{1});
+    ASSERT_TRUE(view.contains(e0));
+    ASSERT_FALSE(view.contains(e1));
+
+    registry.assign<double>(e0);
+
+    ASSERT_TRUE(view.empty());
+
+    registry.remove<double>(e0);
+    registry.remove<double>(e1);
+
+    ASSERT_EQ(view.size(), typename decltype(view)::size_type{2});
+
+    registry.assign<double>(e1);
+    registry.assign<float>(e1);
+    registry.remove<char>(e0);
+
+    ASSERT_TRUE(view.empty());
+
+    registry.assign<char>(e0);
+
+    view.each([e0](const auto entity, int value, char) {
+        ASSERT_EQ(entity, e0);
+        ASSERT_EQ(value, 0);
+    });
+
+    registry.discard<int, char>(entt::exclude<double>);
+
+    ASSERT_FALSE((registry.contains<int, char>(entt::exclude<double>)));
+
+    registry.prepare<int, char>(entt::exclude<double, float>);
+    registry.remove<double>(e1);
+
+    ASSERT_EQ((registry.view<int, char>(entt::persistent_t{}, entt::exclude<double, float>).size()), typename decltype(view)::size_type{1});
+
+    registry.remove<float>(e1);
+
+    ASSERT_EQ((registry.view<int, char>(entt::persistent_t{}, entt::exclude<double, float>).size()), typename decltype(view)::size_type{2});
+}
+
+TEST(PersistentView, EachChangedSince) {
+    entt::DefaultRegistry registry;
+    auto view = registry.view<Tracked, char>(entt::persistent_t{});
+    const auto &cview = view;
+
+    const auto e0 = registry.create();
+    registry.assign<Tracked>(e0, 0);
+    registry.assign<char>(e0);
+
+    registry.advance();
+
+    const auto e1 = registry.create();
+    registry.assign<Tracked>(e1, 1);
+    registry.assign<char>(e1);
+
+    const auto e2 = registry.create();
+    registry.assign<Tracked>(e2, 2);
+
+    std::size_t cnt{};
+
+    view.each_changed_since<Tracked>(1u, [&cnt, e1](const auto entity, auto &tracked, auto &) {
+        ASSERT_EQ(entity, e1);
+        ASSERT_EQ(tracked.value, 1);
+        ++cnt;
+    });
+
+    ASSERT_EQ(cnt, 1u);
+
+    registry.advance();
+    registry.patch<Tracked>(e0, [](auto &tracked) { tracked.value = 3; });
+    registry.patch<Tracked>(e2, [](auto &tracked) { tracked.value = 4; });
+
+    cnt = 0;
+
+    cview.each_changed_since<Tracked>(2u, [&cnt, e0](const auto entity, const auto &tracked, const auto &) {
+        ASSERT_EQ(entity, e0);
+        ASSERT_EQ(tracked.value, 3);
+        ++cnt;
+    });
+
+    ASSERT_EQ(cnt, 1u);
+}
+
 TEST(SingleComponentView, Functionalities) {
     entt::DefaultRegistry registry;
     auto view = registry.view<char>();
@@ -346,6 +481,49 @@ TEST(SingleComponentView, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(SingleComponentView, EachChangedSince) {
+    entt::DefaultRegistry registry;
+    auto view = registry.view<Tracked>();
+    const auto &cview = view;
+
+    registry.assign<Tracked>(registry.create(), 0);
+    registry.advance();
+    registry.assign<Tracked>(registry.create(), 1);
+
+    std::size_t cnt{};
+
+    view.each_changed_since(1u, [&cnt](const auto, auto &tracked) {
+        ASSERT_EQ(tracked.value, 1);
+        ++cnt;
+    });
+
+    ASSERT_EQ(cnt, 1u);
+
+    cview.each_changed_since(0u, [&cnt](const auto, const auto &) { ++cnt; });
+
+    ASSERT_EQ(cnt, 3u);
+}
+
+TEST(SingleComponentView, ParallelEach) {
+    entt::DefaultRegistry registry;
+    entt::JobSystem jobs{4u};
+    auto view = registry.view<int>();
+    const auto &cview = view;
+    std::atomic<int> cnt{};
+
+    for(auto i = 0; i < 1000; ++i) {
+        registry.assign<int>(registry.create(), 0);
+    }
+
+    view.parallel_each(jobs, [](const auto, int &value) { ++value; });
+    cview.parallel_each(jobs, [&cnt](const auto entity, const int &value) {
+        ASSERT_EQ(value, 1);
+        cnt += static_cast<int>(entity) + value;
+    }, 3u);
+
+    ASSERT_EQ(cnt, 1000 * 999 / 2 + 1000);
+}
+
 TEST(MultipleComponentView, Functionalities) {
     entt::DefaultRegistry registry;
     auto view = registry.view<int, char>();
@@ -519,6 +697,149 @@ TEST(MultipleComponentView, EachWithHoles) {
     });
 }
 
+TEST(MultipleComponentView, ParallelEach) {
+    entt::DefaultRegistry registry;
+    entt::JobSystem jobs{4u};
+    auto view = registry.view<int, char>(entt::exclude<double>);
+    const auto &cview = view;
+    std::atomic<int> cnt{};
+
+    for(auto i = 0; i < 1000; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, 0);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+
+        if(i % 3) {
+            registry.assign<double>(entity);
+        }
+    }
+
+    view.parallel_each(jobs, [](const auto, int &value, char &) { ++value; });
+    cview.parallel_each(jobs, [&cnt](const auto, const int &value, const char &) { cnt += value; }, 5u);
+
+    ASSERT_EQ(cnt, 167);
+
+    registry.view<int>().each([&registry](const auto entity, const int value) {
+        ASSERT_EQ(value, int(registry.has<char>(entity) && !registry.has<double>(entity)));
+    });
+}
+
+TEST(MultipleComponentView, Exclude) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0, 0);
+    registry.assign<char>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1, 1);
+    registry.assign<char>(e1);
+    registry.assign<double>(e1);
+
+    const auto e2 = registry.create();
+    registry.assign<int>(e2, 2);
+    registry.assign<char>(e2);
+
+    auto view = registry.view<int, char>(entt::exclude<double>);
+    std::size_t cnt{};
+
+    for(auto entity: view) {
+        ASSERT_NE(entity, e1);
+        ++cnt;
+    }
+
+    ASSERT_EQ(cnt, std::size_t{2});
+    ASSERT_TRUE(view.contains(e0));
+    ASSERT_FALSE(view.contains(e1));
+
+    view.each([e1, &cnt](const auto entity, int value, char) {
+        ASSERT_NE(entity, e1);
+        ASSERT_NE(value, 1);
+        --cnt;
+    });
+
+    ASSERT_EQ(cnt, std::size_t{0});
+
+    registry.assign<double>(e0);
+    registry.assign<double>(e2);
+
+    ASSERT_EQ(view.begin(), view.end());
+
+    view.each([](auto...) {
+        FAIL();
+    });
+}
+
+TEST(MultipleComponentView, ExcludeEmptyOrShortPool) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(ENTT_PAGE_SIZE);
+    registry.create(entities.begin(), entities.end());
+    registry.assign<int>(entities.begin(), entities.end());
+    registry.assign<char>(entities.begin(), entities.end());
+
+    // the pool of the excluded component exists but is empty
+    registry.assure<double>();
+
+    auto view = registry.view<int, char>(entt::exclude<double>);
+    std::size_t cnt{};
+
+    view.each([&cnt](const auto, int, char) { ++cnt; });
+
+    ASSERT_EQ(cnt, entities.size());
+    ASSERT_EQ(std::size_t(std::distance(view.begin(), view.end())), entities.size());
+
+    // only entities with low identifiers own the excluded component
+    registry.assign<double>(entities[0]);
+    cnt = {};
+
+    view.each([&cnt](const auto, int, char) { ++cnt; });
+
+    ASSERT_EQ(cnt, entities.size() - 1u);
+    ASSERT_EQ(std::size_t(std::distance(view.begin(), view.end())), entities.size() - 1u);
+    ASSERT_FALSE(view.contains(entities[0]));
+    ASSERT_TRUE(view.contains(entities.back()));
+}
+
+TEST(MultipleComponentView, EachChangedSince) {
+    entt::DefaultRegistry registry;
+    auto view = registry.view<Tracked, char>(entt::exclude<int>);
+    const auto &cview = view;
+
+    const auto e0 = registry.create();
+    registry.assign<Tracked>(e0, 0);
+    registry.assign<char>(e0);
+
+    registry.advance();
+
+    const auto e1 = registry.create();
+    registry.assign<Tracked>(e1, 1);
+    registry.assign<char>(e1);
+
+    const auto e2 = registry.create();
+    registry.assign<Tracked>(e2, 2);
+    registry.assign<char>(e2);
+    registry.assign<int>(e2);
+
+    registry.assign<Tracked>(registry.create(), 3);
+
+    std::size_t cnt{};
+
+    view.each_changed_since<Tracked>(1u, [&cnt, e1](const auto entity, auto &tracked, auto &) {
+        ASSERT_EQ(entity, e1);
+        ASSERT_EQ(tracked.value, 1);
+        ++cnt;
+    });
+
+    ASSERT_EQ(cnt, 1u);
+
+    cview.each_changed_since<Tracked>(0u, [&cnt](const auto, const auto &, const auto &) { ++cnt; });
+
+    ASSERT_EQ(cnt, 3u);
+}
+
 TEST(RawView, Functionalities) {
     entt::DefaultRegistry registry;
     auto view = registry.view<char>(entt::raw_t{});
@@ -630,6 +951,23 @@ TEST(RawView, Each) {
     ASSERT_EQ(cnt, std::size_t{0});
 }
 
+TEST(RawView, ParallelEach) {
+    entt::DefaultRegistry registry;
+    entt::JobSystem jobs{4u};
+    auto view = registry.view<int>(entt::raw_t{});
+    const auto &cview = view;
+    std::atomic<int> cnt{};
+
+    for(auto i = 0; i < 1000; ++i) {
+        registry.assign<int>(registry.create(), i);
+    }
+
+    view.parallel_each(jobs, [](int &value) { ++value; });
+    cview.parallel_each(jobs, [&cnt](const int &value) { cnt += value; }, 10u);
+
+    ASSERT_EQ(cnt, 1000 * 1001 / 2);
+}
+
 TEST(RuntimeView, Functionalities) {
     entt::DefaultRegistry registry;
     using component_type = typename decltype(registry)::component_type;
@@ -812,6 +1150,55 @@ TEST(RuntimeView, EachWithHoles) {
     });
 }
 
+TEST(RuntimeView, Exclude) {
+    entt::DefaultRegistry registry;
+
+    const auto e0 = registry.create();
+    registry.assign<int>(e0);
+    registry.assign<char>(e0);
+
+    const auto e1 = registry.create();
+    registry.assign<int>(e1);
+    registry.assign<char>(e1);
+    registry.assign<double>(e1);
+
+    using component_type = typename decltype(registry)::component_type;
+    component_type types[] = { registry.type<int>(), registry.type<char>() };
+    component_type filter[] = { registry.type<double>(), registry.type<float>() };
+    auto view = registry.view(std::begin(types), std::end(types), std::begin(filter), std::end(filter));
+
+    ASSERT_TRUE(view.contains(e0));
+    ASSERT_FALSE(view.contains(e1));
+    ASSERT_EQ(*view.begin(), e0);
+    ASSERT_EQ(++view.begin(), view.end());
+
+    view.each([e0](const auto entity) {
+        ASSERT_EQ(entity, e0);
+    });
+}
+
+TEST(RuntimeView, ExcludeEmptyOrShortPool) {
+    entt::DefaultRegistry registry;
+    std::vector<entt::DefaultRegistry::entity_type> entities(ENTT_PAGE_SIZE);
+    registry.create(entities.begin(), entities.end());
+    registry.assign<int>(entities.begin(), entities.end());
+    registry.assign<char>(entities.begin(), entities.end());
+    registry.assure<double>();
+
+    using component_type = typename decltype(registry)::component_type;
+    component_type types[] = { registry.type<int>(), registry.type<char>() };
+    component_type filter[] = { registry.type<double>() };
+    auto view = registry.view(std::begin(types), std::end(types), std::begin(filter), std::end(filter));
+
+    ASSERT_EQ(std::size_t(std::distance(view.begin(), view.end())), entities.size());
+
+    registry.assign<double>(entities[0]);
+
+    ASSERT_EQ(std::size_t(std::distance(view.begin(), view.end())), entities.size() - 1u);
+    ASSERT_FALSE(view.contains(entities[0]));
+    ASSERT_TRUE(view.contains(entities.back()));
+}
+
 TEST(RuntimeView, MissingPool) {
     entt::DefaultRegistry registry;
     using component_type = typename decltype(registry)::component_type;
@@ -860,3 +1247,29 @@ TEST(RuntimeView, EmptyRange) {
         FAIL();
     }
 }
+
+TEST(RuntimeView, ParallelEach) {
+    entt::DefaultRegistry registry;
+    entt::JobSystem jobs{4u};
+    using component_type = typename decltype(registry)::component_type;
+    std::atomic<int> cnt{};
+
+    for(auto i = 0; i < 1000; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+    }
+
+    component_type types[] = { registry.type<int>(), registry.type<char>() };
+    auto view = registry.view(std::begin(types), std::end(types));
+
+    view.parallel_each(jobs, [&cnt, &registry](const auto entity) {
+        ASSERT_TRUE((registry.has<int, char>(entity)));
+        ++cnt;
+    });
+
+    ASSERT_EQ(cnt, 500);
+}
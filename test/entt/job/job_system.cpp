@@ -0,0 +1,202 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <entt/job/job_system.hpp>
+
+TEST(JobSystem, Functionalities) {
+    entt::JobSystem jobs{4u};
+    std::vector<std::atomic<int>> data(100000);
+
+    ASSERT_EQ(jobs.concurrency(), 4u);
+
+    jobs.parallel_for(data.size(), 0u, [&data](const auto first, const auto last) {
+        for(auto pos = first; pos < last; ++pos) {
+            ++data[pos];
+        }
+    });
+
+    ASSERT_TRUE(std::all_of(data.cbegin(), data.cend(), [](const auto &value) { return value == 1; }));
+
+    jobs.parallel_for(data.size(), 3u, [&data](const auto first, const auto last) {
+        ASSERT_LE(last - first, 3u);
+
+        for(auto pos = first; pos < last; ++pos) {
+            ++data[pos];
+        }
+    });
+
+    ASSERT_TRUE(std::all_of(data.cbegin(), data.cend(), [](const auto &value) { return value == 2; }));
+
+    jobs.parallel_for(0u, 0u, [](const auto, const auto) {
+        FAIL();
+    });
+}
+
+TEST(JobSystem, DeterministicChunking) {
+    using chunk_type = std::pair<std::size_t, std::size_t>;
+
+    auto chunks = [](entt::JobSystem &jobs) {
+        std::vector<chunk_type> result;
+        std::mutex mutex;
+
+        jobs.parallel_for(1000u, 64u, [&result, &mutex](const auto first, const auto last) {
+            std::lock_guard<std::mutex> guard{mutex};
+            result.emplace_back(first, last);
+        });
+
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    entt::JobSystem single{1u};
+    entt::JobSystem multi{4u};
+    const auto expected = chunks(single);
+
+    ASSERT_EQ(expected.size(), 16u);
+    ASSERT_EQ(expected.front(), chunk_type(0u, 64u));
+    ASSERT_EQ(expected.back(), chunk_type(960u, 1000u));
+    ASSERT_EQ(chunks(multi), expected);
+}
+
+TEST(JobSystem, Nested) {
+    entt::JobSystem jobs{4u};
+    std::atomic<int> counter{};
+
+    jobs.parallel_for(16u, 1u, [&jobs, &counter](const auto, const auto) {
+        jobs.parallel_for(100u, 10u, [&counter](const auto first, const auto last) {
+            counter += static_cast<int>(last - first);
+        });
+    });
+
+    ASSERT_EQ(counter, 1600);
+}
+
+TEST(JobSystem, ExternalThreads) {
+    entt::JobSystem jobs{2u};
+    std::atomic<int> counter{};
+    std::vector<std::thread> threads;
+
+    for(auto i = 0; i < 4; ++i) {
+        threads.emplace_back([&jobs, &counter]() {
+            for(auto j = 0; j < 10; ++j) {
+                jobs.parallel_for(1000u, 7u, [&counter](const auto first, const auto last) {
+                    counter += static_cast<int>(last - first);
+                });
+            }
+        });
+    }
+
+    for(auto &&thread: threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(counter, 40000);
+}
+
+TEST(JobSystem, Spawn) {
+    entt::JobSystem jobs{4u};
+    entt::JobSystem::Handle handle{};
+    std::atomic<int> counter{};
+
+    ASSERT_FALSE(handle);
+    ASSERT_TRUE(handle.done());
+
+    jobs.wait(handle);
+    handle = jobs.spawn([&counter]() { ++counter; });
+
+    ASSERT_TRUE(handle);
+
+    jobs.wait(handle);
+
+    ASSERT_TRUE(handle.done());
+    ASSERT_EQ(counter, 1);
+
+    std::vector<entt::JobSystem::Handle> handles;
+
+    for(auto i = 0; i < 1000; ++i) {
+        handles.push_back(jobs.spawn([&counter]() { ++counter; }));
+    }
+
+    for(auto &&other: handles) {
+        jobs.wait(other);
+    }
+
+    ASSERT_EQ(counter, 1001);
+}
+
+TEST(JobSystem, Continuations) {
+    entt::JobSystem jobs{4u};
+    std::vector<int> sequence;
+    std::mutex mutex;
+
+    auto push = [&sequence, &mutex](int value) {
+        return [&sequence, &mutex, value]() {
+            std::lock_guard<std::mutex> guard{mutex};
+            sequence.push_back(value);
+        };
+    };
+
+    auto handle = jobs.spawn(push(0));
+
+    for(auto i = 1; i < 100; ++i) {
+        handle = jobs.then(handle, push(i));
+    }
+
+    jobs.wait(handle);
+
+    ASSERT_EQ(sequence.size(), 100u);
+
+    for(auto i = 0; i < 100; ++i) {
+        ASSERT_EQ(sequence[i], i);
+    }
+
+    jobs.wait(jobs.then(handle, push(100)));
+
+    ASSERT_EQ(sequence.back(), 100);
+}
+
+TEST(JobSystem, Dependencies) {
+    entt::JobSystem jobs{4u};
+    std::atomic<int> counter{};
+    std::vector<entt::JobSystem::Handle> handles;
+
+    for(auto i = 0; i < 64; ++i) {
+        handles.push_back(jobs.spawn([&counter]() { ++counter; }));
+    }
+
+    handles.emplace_back();
+
+    const auto handle = jobs.spawn(handles.cbegin(), handles.cend(), [&counter]() {
+        ASSERT_EQ(counter, 64);
+        counter = -1;
+    });
+
+    jobs.wait(handle);
+
+    ASSERT_EQ(counter, -1);
+}
+
+TEST(JobSystem, SpawnFromJobs) {
+    std::atomic<int> counter{};
+
+    {
+        entt::JobSystem jobs{4u};
+
+        const auto handle = jobs.spawn([&jobs, &counter]() {
+            for(auto i = 0; i < 100; ++i) {
+                jobs.spawn([&jobs, &counter]() {
+                    jobs.then(jobs.spawn([&counter]() { ++counter; }), [&counter]() { ++counter; });
+                });
+            }
+        });
+
+        jobs.wait(handle);
+    }
+
+    // the destructor waits for the pending jobs
+    ASSERT_EQ(counter, 200);
+}
@@ -1,5 +1,7 @@
+#include <atomic>
 #include <functional>
 #include <gtest/gtest.h>
+#include <entt/job/job_system.hpp>
 #include <entt/process/scheduler.hpp>
 #include <entt/process/process.hpp>
 
@@ -111,3 +113,43 @@ TEST(Scheduler, Functor) {
     ASSERT_TRUE(firstFunctor);
     ASSERT_TRUE(secondFunctor);
 }
+
+TEST(Scheduler, ParallelUpdate) {
+    entt::Scheduler<int> scheduler;
+    entt::Scheduler<int> expected;
+    entt::JobSystem jobs{4u};
+    std::atomic<int> cnt{};
+    std::atomic<int> other{};
+
+    auto attach = [](auto &sched, auto &counter) {
+        for(auto i = 0; i < 100; ++i) {
+            sched.attach([&counter](auto delta, void *, auto resolve, auto){
+                counter += delta;
+                resolve();
+            }).then([&counter, i](auto delta, void *, auto resolve, auto reject){
+                counter += delta;
+                (i % 2) ? resolve() : reject();
+            }).then([&counter](auto delta, void *, auto, auto){
+                counter += delta;
+            });
+        }
+    };
+
+    attach(scheduler, cnt);
+    attach(expected, other);
+
+    while(!expected.empty()) {
+        scheduler.parallel_update(jobs, 1);
+        expected.update(1);
+
+        ASSERT_EQ(cnt, other);
+        ASSERT_EQ(scheduler.size(), expected.size());
+
+        if(cnt > 1000) {
+            scheduler.abort(true);
+            expected.abort(true);
+        }
+    }
+
+    ASSERT_TRUE(scheduler.empty());
+}
@@ -1,5 +1,7 @@
 #include <memory>
 #include <gtest/gtest.h>
+#include <entt/core/memory.hpp>
+#include <entt/job/job_system.hpp>
 #include <entt/signal/dispatcher.hpp>
 
 struct AnEvent {};
@@ -11,6 +13,11 @@ struct Receiver {
     int cnt{0};
 };
 
+struct AnotherReceiver {
+    void receive(const AnotherEvent &) { ++cnt; }
+    int cnt{0};
+};
+
 TEST(Dispatcher, Functionalities) {
     entt::Dispatcher dispatcher;
     Receiver receiver;
@@ -38,3 +45,42 @@ TEST(Dispatcher, Functionalities) {
 
     ASSERT_EQ(receiver.cnt, 0);
 }
+
+TEST(Dispatcher, MemoryResource) {
+    entt::MonotonicResource resource;
+    entt::Dispatcher dispatcher{&resource};
+    Receiver receiver;
+
+    dispatcher.template sink<AnEvent>().connect(&receiver);
+    dispatcher.template enqueue<AnEvent>();
+    dispatcher.template enqueue<AnEvent>();
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 2);
+}
+
+TEST(Dispatcher, ParallelUpdate) {
+    entt::Dispatcher dispatcher;
+    entt::JobSystem jobs{4u};
+    Receiver receiver;
+    AnotherReceiver another;
+
+    dispatcher.template sink<AnEvent>().connect(&receiver);
+    dispatcher.template sink<AnotherEvent>().connect(&another);
+
+    for(auto i = 0; i < 100; ++i) {
+        dispatcher.template enqueue<AnEvent>();
+        dispatcher.template enqueue<AnotherEvent>();
+        dispatcher.template enqueue<AnotherEvent>();
+    }
+
+    dispatcher.parallel_update(jobs);
+
+    ASSERT_EQ(receiver.cnt, 100);
+    ASSERT_EQ(another.cnt, 200);
+
+    dispatcher.parallel_update(jobs);
+
+    ASSERT_EQ(receiver.cnt, 100);
+    ASSERT_EQ(another.cnt, 200);
+}
@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
+#include <entt/core/memory.hpp>
 #include <entt/signal/emitter.hpp>
 
-struct TestEmitter: entt::Emitter<TestEmitter> {};
+struct TestEmitter: entt::Emitter<TestEmitter> {
+    using entt::Emitter<TestEmitter>::Emitter;
+};
 
 struct FooEvent { int i; char c; };
 struct BarEvent {};
@@ -115,3 +118,16 @@ TEST(Emitter, OnAndErase) {
     ASSERT_TRUE(emitter.empty());
     ASSERT_TRUE(emitter.empty<BarEvent>());
 }
+
+TEST(Emitter, MemoryResource) {
+    entt::MonotonicResource resource;
+    TestEmitter emitter{&resource};
+    int counter = 0;
+
+    emitter.on<FooEvent>([&counter](const auto &, const auto &){ ++counter; });
+    emitter.once<FooEvent>([&counter](const auto &, const auto &){ ++counter; });
+    emitter.publish<FooEvent>(0, 'c');
+    emitter.publish<FooEvent>(0, 'c');
+
+    ASSERT_EQ(counter, 3);
+}
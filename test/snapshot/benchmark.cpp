@@ -0,0 +1,114 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <cereal/archives/binary.hpp>
+#include <entt/entity/archive.hpp>
+#include <entt/entity/registry.hpp>
+
+struct Position {
+    std::uint64_t x;
+    std::uint64_t y;
+};
+
+struct Velocity {
+    std::uint64_t x;
+    std::uint64_t y;
+};
+
+template<typename Archive>
+void serialize(Archive &archive, Position &position) {
+  archive(position.x, position.y);
+}
+
+template<typename Archive>
+void serialize(Archive &archive, Velocity &velocity) {
+  archive(velocity.x, velocity.y);
+}
+
+struct Timer final {
+    Timer(): start{std::chrono::system_clock::now()} {}
+
+    void elapsed() {
+        auto now = std::chrono::system_clock::now();
+        std::cout << std::chrono::duration<double>(now - start).count() << " seconds" << std::endl;
+    }
+
+private:
+    std::chrono::time_point<std::chrono::system_clock> start;
+};
+
+void populate(entt::DefaultRegistry &registry) {
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Position>(entity, i, i);
+        registry.assign<Velocity>(entity, i, i);
+    }
+}
+
+TEST(Benchmark, CerealBinaryArchive1M) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry other;
+    std::stringstream storage;
+
+    std::cout << "Saving and loading a snapshot of 1000000 entities with two components, cereal binary archives" << std::endl;
+
+    populate(registry);
+    Timer timer;
+
+    {
+        cereal::BinaryOutputArchive output{storage};
+        registry.snapshot().entities(output).component<Position, Velocity>(output);
+    }
+
+    cereal::BinaryInputArchive input{storage};
+    other.restore().entities(input).component<Position, Velocity>(input);
+    timer.elapsed();
+
+    ASSERT_EQ(other.size<Velocity>(), 1000000u);
+}
+
+TEST(Benchmark, BinaryArchive1M) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry other;
+    std::stringstream storage;
+
+    std::cout << "Saving and loading a snapshot of 1000000 entities with two components, built-in archives" << std::endl;
+
+    populate(registry);
+    Timer timer;
+
+    {
+        entt::OutputArchive output{storage};
+        registry.snapshot().entities(output).component<Position, Velocity>(output);
+    }
+
+    entt::InputArchive input{storage};
+    other.restore().entities(input).component<Position, Velocity>(input);
+    timer.elapsed();
+
+    ASSERT_EQ(other.size<Velocity>(), 1000000u);
+}
+
+TEST(Benchmark, BinaryArchiveBulk1M) {
+    entt::DefaultRegistry registry;
+    entt::DefaultRegistry other;
+    std::stringstream storage;
+
+    std::cout << "Saving and loading a snapshot of 1000000 entities with two components, built-in archives and contiguous blocks" << std::endl;
+
+    populate(registry);
+    Timer timer;
+
+    {
+        entt::OutputArchive output{storage};
+        registry.snapshot().entities(output).component<Position, Velocity>(entt::raw_t{}, output);
+    }
+
+    entt::InputArchive input{storage};
+    other.restore().entities(input).component<Position, Velocity>(entt::raw_t{}, input);
+    timer.elapsed();
+
+    ASSERT_EQ(other.size<Velocity>(), 1000000u);
+}